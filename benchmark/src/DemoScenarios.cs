@@ -0,0 +1,99 @@
+/*
+ * NPlot - A charting library for .NET
+ * 
+ * DemoScenarios.cs
+ * Copyright (C) 2003-2006 Matt Howlett and others.
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+using System;
+using System.Collections;
+using System.Reflection;
+using NPlotDemo;
+
+namespace NPlotBenchmark
+{
+    /// <summary>
+    /// The demo plots, drawn by the DemoPlots routines the PlotSurface2DDemo window
+    /// shows (the source file is shared with the demo, along with the resources it
+    /// loads). Every public DemoPlots routine named Plot... is a scenario. They are
+    /// fixed charts, so the size passed to them is ignored. Random data comes from
+    /// a fixed seed, and the interactions the window adds are left out.
+    /// </summary>
+    public class DemoScenarios
+    {
+        /// <summary>
+        /// Sets up a surface with one DemoPlots routine.
+        /// </summary>
+        private class Demo
+        {
+            private readonly MethodInfo routine_;
+
+            /// <summary>
+            /// Constructor
+            /// </summary>
+            /// <param name="routine">the DemoPlots routine.</param>
+            public Demo(MethodInfo routine)
+            {
+                routine_ = routine;
+            }
+
+            /// <summary>
+            /// Sets up a plot surface with the routine. See ScenarioSetup.
+            /// </summary>
+            public void Setup(NPlot.Bitmap.PlotSurface2D surface, int size)
+            {
+                DemoPlots plots = new DemoPlots(surface, new Random(0));
+                routine_.Invoke(plots, null);
+            }
+        }
+
+        /// <summary>
+        /// All of the demo scenarios, in order of name.
+        /// </summary>
+        public static readonly Scenarios.Scenario[] All = Find();
+
+        /// <summary>
+        /// Makes a scenario of each DemoPlots routine.
+        /// </summary>
+        private static Scenarios.Scenario[] Find()
+        {
+            SortedList routines = new SortedList();
+            foreach (MethodInfo m in typeof (DemoPlots).GetMethods(BindingFlags.Public | BindingFlags.Instance))
+            {
+                if (m.Name.StartsWith("Plot") && m.GetParameters().Length == 0)
+                {
+                    routines.Add(m.Name, m);
+                }
+            }
+
+            Scenarios.Scenario[] all = new Scenarios.Scenario[routines.Count];
+            for (int i = 0; i < routines.Count; ++i)
+            {
+                MethodInfo m = (MethodInfo) routines.GetByIndex(i);
+                all[i] = new Scenarios.Scenario("Demo" + m.Name.Substring("Plot".Length), new Demo(m).Setup);
+            }
+            return all;
+        }
+    }
+}
\ No newline at end of file
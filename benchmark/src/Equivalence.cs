@@ -0,0 +1,325 @@
+/*
+ * NPlot - A charting library for .NET
+ * 
+ * Equivalence.cs
+ * Copyright (C) 2003-2006 Matt Howlett and others.
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+using System;
+using System.Diagnostics;
+using System.Drawing;
+using System.Drawing.Imaging;
+using System.Globalization;
+using System.IO;
+using System.Runtime.InteropServices;
+using NPlot;
+
+namespace NPlotBenchmark
+{
+    /// <summary>
+    /// Checks that a faster render path draws the same picture as the path it
+    /// replaces. Each scenario is set up on two Bitmap.PlotSurface2Ds, one drawing
+    /// the reference way and one the optimized way. Both are timed, and the
+    /// results compared pixel by pixel.
+    /// </summary>
+    public class Equivalence
+    {
+        /// <summary>
+        /// Sets a surface to draw by the reference path (reference true) or by
+        /// the optimized path (reference false).
+        /// </summary>
+        public delegate void PathSetup(NPlot.Bitmap.PlotSurface2D surface, bool reference);
+
+        /// <summary>
+        /// A render path that can be checked.
+        /// </summary>
+        public class Path
+        {
+            /// <summary>
+            /// Constructor
+            /// </summary>
+            /// <param name="name">name of the path.</param>
+            /// <param name="setup">method that selects the path on a surface.</param>
+            public Path(string name, PathSetup setup)
+            {
+                Name = name;
+                Setup = setup;
+            }
+
+            /// <summary>
+            /// Name of the path, used in the results.
+            /// </summary>
+            public string Name { get; private set; }
+
+            /// <summary>
+            /// Selects the reference or the optimized path on a surface.
+            /// </summary>
+            public PathSetup Setup { get; private set; }
+        }
+
+        /// <summary>
+        /// The paths that can be checked. "reference" turns off, with
+        /// PlotSurface2D.ReferencePath, all the optimizations that should draw
+        /// exactly the same thing: bulk transforms, drawing the visible slice, and
+        /// the kept axis suggestions, legend layout, plot background, stacked heights
+        /// and fitted brushes. "preview" checks preview drawing against full quality,
+        /// and "aggregation" merged candles against every candle. Those two leave
+        /// detail out on purpose, so need a looser tolerance.
+        /// </summary>
+        public static readonly Path[] Paths =
+            {
+                new Path("reference", SetupReference),
+                new Path("preview", SetupPreview),
+                new Path("aggregation", SetupAggregation)
+            };
+
+        private static void SetupReference(NPlot.Bitmap.PlotSurface2D surface, bool reference)
+        {
+            surface.ReferencePath = reference;
+        }
+
+        private static void SetupPreview(NPlot.Bitmap.PlotSurface2D surface, bool reference)
+        {
+            surface.Quality = reference ? DrawQuality.Full : DrawQuality.Preview;
+        }
+
+        private static void SetupAggregation(NPlot.Bitmap.PlotSurface2D surface, bool reference)
+        {
+            foreach (object drawable in surface.Drawables)
+            {
+                CandlePlot cp = drawable as CandlePlot;
+                if (cp != null && reference)
+                {
+                    cp.MinCandleSpacing = 0;
+                }
+            }
+        }
+
+        /// <summary>
+        /// The largest difference in any colour channel for two pixels to still be counted as the same.
+        /// </summary>
+        public int Tolerance { get; set; }
+
+        /// <summary>
+        /// The fraction of pixels that may differ for the result to still pass.
+        /// </summary>
+        public double MaxDifferingFraction { get; set; }
+
+        /// <summary>
+        /// Factor to zoom into the middle of the x axis by before drawing. 1 draws
+        /// the whole of the data; more draws a slice of it, which is needed to check
+        /// drawing only the visible slice.
+        /// </summary>
+        public double Zoom { get; set; }
+
+        /// <summary>
+        /// Number of timed draws of each surface.
+        /// </summary>
+        public int Frames { get; set; }
+
+        /// <summary>
+        /// If not null, the reference, optimized and difference images of failing
+        /// scenarios are saved in this directory.
+        /// </summary>
+        public string DiffDirectory { get; set; }
+
+        /// <summary>
+        /// Writes the header line of the results.
+        /// </summary>
+        /// <param name="writer">where to write it.</param>
+        public static void WriteHeader(TextWriter writer)
+        {
+            writer.WriteLine("scenario,path,size,zoom,differing_pixels,max_channel_diff,reference_ms,optimized_ms,speedup,result");
+        }
+
+        /// <summary>
+        /// Draws a scenario both ways, writes a line of results.
+        /// </summary>
+        /// <param name="writer">where to write the results.</param>
+        /// <param name="scenario">the scenario to draw.</param>
+        /// <param name="size">the amount of data to give the scenario.</param>
+        /// <param name="path">the path to check.</param>
+        /// <param name="width">width of the images.</param>
+        /// <param name="height">height of the images.</param>
+        /// <returns>true if the images are the same within the tolerance.</returns>
+        public bool Check(TextWriter writer, Scenarios.Scenario scenario, int size, Path path, int width, int height)
+        {
+            NPlot.Bitmap.PlotSurface2D reference = new NPlot.Bitmap.PlotSurface2D(width, height);
+            NPlot.Bitmap.PlotSurface2D optimized = new NPlot.Bitmap.PlotSurface2D(width, height);
+            try
+            {
+                // the path is selected before the scenario is set up, so that it
+                // applies as plots are added, and again after, as setting up may
+                // clear the surface.
+                path.Setup(reference, true);
+                scenario.Setup(reference, size);
+                path.Setup(reference, true);
+                ZoomIn(reference);
+                path.Setup(optimized, false);
+                scenario.Setup(optimized, size);
+                path.Setup(optimized, false);
+                ZoomIn(optimized);
+
+                double referenceMs = Time(reference);
+                double optimizedMs = Time(optimized);
+
+                int[] a = Pixels(reference.Bitmap);
+                int[] b = Pixels(optimized.Bitmap);
+
+                int differing = 0;
+                int maxDiff = 0;
+                int[] diff = new int[a.Length];
+                for (int i = 0; i < a.Length; ++i)
+                {
+                    int d = ChannelDifference(a[i], b[i]);
+                    maxDiff = Math.Max(maxDiff, d);
+                    if (d > Tolerance)
+                    {
+                        ++differing;
+                        diff[i] = unchecked((int) 0xffff0000);
+                    }
+                    else
+                    {
+                        // faded reference, so the differences can be placed.
+                        diff[i] = (a[i] & 0x00ffffff) | 0x40000000;
+                    }
+                }
+
+                bool pass = differing <= MaxDifferingFraction*a.Length;
+
+                writer.WriteLine(String.Format(CultureInfo.InvariantCulture,
+                                               "{0},{1},{2},{3},{4},{5},{6:0.###},{7:0.###},{8:0.##},{9}",
+                                               scenario.Name, path.Name, size, Zoom, differing, maxDiff,
+                                               referenceMs, optimizedMs,
+                                               optimizedMs > 0.0 ? referenceMs/optimizedMs : 0.0,
+                                               pass ? "pass" : "fail"));
+                writer.Flush();
+
+                if (!pass && DiffDirectory != null)
+                {
+                    string name = System.IO.Path.Combine(DiffDirectory,
+                                                         String.Format(CultureInfo.InvariantCulture, "{0}_{1}_{2}_{3}",
+                                                                       scenario.Name, size, Zoom, path.Name));
+                    reference.Bitmap.Save(name + "_reference.png", ImageFormat.Png);
+                    optimized.Bitmap.Save(name + "_optimized.png", ImageFormat.Png);
+                    using (System.Drawing.Bitmap diffImage = ToBitmap(diff, width, height))
+                    {
+                        diffImage.Save(name + "_diff.png", ImageFormat.Png);
+                    }
+                }
+
+                return pass;
+            }
+            finally
+            {
+                reference.Bitmap.Dispose();
+                optimized.Bitmap.Dispose();
+            }
+        }
+
+        /// <summary>
+        /// Narrows the x axis of a surface to the middle 1/Zoom of its range.
+        /// </summary>
+        private void ZoomIn(NPlot.Bitmap.PlotSurface2D surface)
+        {
+            if (Zoom <= 1.0 || surface.XAxis1 == null)
+                return;
+
+            Axis a = surface.XAxis1;
+            double middle = (a.WorldMin + a.WorldMax)/2.0;
+            double half = (a.WorldMax - a.WorldMin)/(2.0*Zoom);
+            a.WorldMin = middle - half;
+            a.WorldMax = middle + half;
+        }
+
+        /// <summary>
+        /// Mean milliseconds to draw a surface, which is left holding the last draw.
+        /// </summary>
+        private double Time(NPlot.Bitmap.PlotSurface2D surface)
+        {
+            // the first draw pays for JIT compilation and caches.
+            surface.Refresh();
+
+            Stopwatch sw = Stopwatch.StartNew();
+            for (int i = 0; i < Frames; ++i)
+            {
+                surface.Refresh();
+            }
+            sw.Stop();
+            return sw.Elapsed.TotalMilliseconds/Math.Max(1, Frames);
+        }
+
+        /// <summary>
+        /// The largest difference between two ARGB pixels in any one channel.
+        /// </summary>
+        private static int ChannelDifference(int a, int b)
+        {
+            int max = 0;
+            for (int shift = 0; shift < 32; shift += 8)
+            {
+                int d = Math.Abs(((a >> shift) & 0xff) - ((b >> shift) & 0xff));
+                if (d > max)
+                    max = d;
+            }
+            return max;
+        }
+
+        private static int[] Pixels(System.Drawing.Bitmap bitmap)
+        {
+            Rectangle r = new Rectangle(0, 0, bitmap.Width, bitmap.Height);
+            BitmapData data = bitmap.LockBits(r, ImageLockMode.ReadOnly, PixelFormat.Format32bppArgb);
+            try
+            {
+                int[] pixels = new int[bitmap.Width*bitmap.Height];
+                for (int y = 0; y < bitmap.Height; ++y)
+                {
+                    Marshal.Copy(new IntPtr(data.Scan0.ToInt64() + (long) y*data.Stride), pixels, y*bitmap.Width, bitmap.Width);
+                }
+                return pixels;
+            }
+            finally
+            {
+                bitmap.UnlockBits(data);
+            }
+        }
+
+        private static System.Drawing.Bitmap ToBitmap(int[] pixels, int width, int height)
+        {
+            System.Drawing.Bitmap bitmap = new System.Drawing.Bitmap(width, height, PixelFormat.Format32bppArgb);
+            BitmapData data = bitmap.LockBits(new Rectangle(0, 0, width, height), ImageLockMode.WriteOnly, PixelFormat.Format32bppArgb);
+            try
+            {
+                for (int y = 0; y < height; ++y)
+                {
+                    Marshal.Copy(pixels, y*width, new IntPtr(data.Scan0.ToInt64() + (long) y*data.Stride), width);
+                }
+            }
+            finally
+            {
+                bitmap.UnlockBits(data);
+            }
+            return bitmap;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,145 @@
+/*
+ * NPlot - A charting library for .NET
+ * 
+ * LoadBenchmark.cs
+ * Copyright (C) 2003-2006 Matt Howlett and others.
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+using System;
+using System.Data;
+using System.Globalization;
+using System.IO;
+using NPlot;
+
+namespace NPlotBenchmark
+{
+    /// <summary>
+    /// Compares loading the same share price data from an XML DataSet (as the demo's
+    /// asx_jbh.xml is loaded), from CSV and from the OhlcvData binary format. The
+    /// files are written to the temp directory by the constructor.
+    /// </summary>
+    public class LoadBenchmark
+    {
+        private readonly string xmlPath_;
+        private readonly string csvPath_;
+        private readonly string binaryPath_;
+
+        /// <summary>
+        /// Constructor. Writes the three files.
+        /// </summary>
+        /// <param name="size">number of rows of data.</param>
+        public LoadBenchmark(int size)
+        {
+            string basePath = Path.Combine(Path.GetTempPath(), "nplot_benchmark_" + size);
+            xmlPath_ = basePath + ".xml";
+            csvPath_ = basePath + ".csv";
+            binaryPath_ = basePath + ".bin";
+
+            Random r = new Random(0);
+            double[] date = new double[size];
+            double[] open = new double[size];
+            double[] high = new double[size];
+            double[] low = new double[size];
+            double[] close = new double[size];
+            double[] volume = new double[size];
+
+            DateTime start = new DateTime(2000, 1, 3);
+            double price = 10.0;
+            for (int i = 0; i < size; ++i)
+            {
+                date[i] = start.AddDays(i).Ticks;
+                // float precision, so that all three formats hold the same values.
+                open[i] = (float) price;
+                price *= 1.0 + 0.02*(r.NextDouble() - 0.5);
+                close[i] = (float) price;
+                high[i] = (float) (Math.Max(open[i], close[i])*(1.0 + 0.01*r.NextDouble()));
+                low[i] = (float) (Math.Min(open[i], close[i])*(1.0 - 0.01*r.NextDouble()));
+                volume[i] = r.Next(1000, 1000000);
+            }
+
+            DataSet ds = new DataSet();
+            DataTable dt = ds.Tables.Add("asx_jbh");
+            dt.Columns.Add("Date", typeof (DateTime));
+            dt.Columns.Add("Open", typeof (float));
+            dt.Columns.Add("Low", typeof (float));
+            dt.Columns.Add("High", typeof (float));
+            dt.Columns.Add("Close", typeof (float));
+            dt.Columns.Add("Volume", typeof (long));
+            for (int i = 0; i < size; ++i)
+            {
+                dt.Rows.Add(new DateTime((long) date[i]), (float) open[i], (float) low[i],
+                            (float) high[i], (float) close[i], (long) volume[i]);
+            }
+            ds.WriteXml(xmlPath_, XmlWriteMode.WriteSchema);
+
+            using (StreamWriter writer = new StreamWriter(csvPath_))
+            {
+                writer.WriteLine("Date,Open,High,Low,Close,Volume");
+                for (int i = 0; i < size; ++i)
+                {
+                    writer.WriteLine(string.Format(CultureInfo.InvariantCulture, "{0:yyyy-MM-dd},{1},{2},{3},{4},{5}",
+                                                   new DateTime((long) date[i]), (float) open[i], (float) high[i],
+                                                   (float) low[i], (float) close[i], (long) volume[i]));
+                }
+            }
+
+            new OhlcvData(date, open, high, low, close, volume).WriteBinary(binaryPath_);
+        }
+
+        /// <summary>
+        /// Reads the XML file into a DataSet.
+        /// </summary>
+        public void LoadXml()
+        {
+            DataSet ds = new DataSet();
+            ds.ReadXml(xmlPath_, XmlReadMode.ReadSchema);
+        }
+
+        /// <summary>
+        /// Reads the CSV file into OhlcvData.
+        /// </summary>
+        public void LoadCsv()
+        {
+            OhlcvData.ReadCsv(csvPath_);
+        }
+
+        /// <summary>
+        /// Reads the binary file into OhlcvData.
+        /// </summary>
+        public void LoadBinary()
+        {
+            OhlcvData.ReadBinary(binaryPath_);
+        }
+
+        /// <summary>
+        /// Deletes the files.
+        /// </summary>
+        public void Delete()
+        {
+            File.Delete(xmlPath_);
+            File.Delete(csvPath_);
+            File.Delete(binaryPath_);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,330 @@
+/*
+ * NPlot - A charting library for .NET
+ * 
+ * Program.cs
+ * Copyright (C) 2003-2006 Matt Howlett and others.
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+using System;
+using System.Collections;
+using System.Diagnostics;
+using System.Globalization;
+using System.IO;
+
+namespace NPlotBenchmark
+{
+    /// <summary>
+    /// A piece of work to be timed.
+    /// </summary>
+    public delegate void Operation();
+
+    /// <summary>
+    /// Headless benchmark of NPlot. Each rendering scenario is drawn to a
+    /// Bitmap.PlotSurface2D at a number of data sizes, and the data loaders
+    /// are compared on files of the same sizes. Results are written to the
+    /// standard output as CSV, one line per benchmark and size, so that they
+    /// can be collected and compared between versions.
+    /// </summary>
+    /// <remarks>
+    /// With --compare, instead checks the optimized render paths against the
+    /// reference ones (see Equivalence) for every scenario, including all of
+    /// the demo plots, both showing all of the data and zoomed in, and exits
+    /// with 1 if any image differs by more than the tolerance.
+    /// </remarks>
+    public class Program
+    {
+        private const string usage_ =
+            "usage: NPlotBenchmark [--sizes 1000,10000,...] [--frames n] [--width w] [--height h]\n" +
+            "                      [--only name,name,...] [--no-render] [--no-load] [--output file]\n" +
+            "       NPlotBenchmark --compare [--paths reference,preview,aggregation] [--zooms 1,10,...]\n" +
+            "                      [--tolerance n] [--max-differing f] [--diff-dir dir]\n" +
+            "                      [--sizes ...] [--frames n] [--width w] [--height h] [--only ...]";
+
+        private static TextWriter out_ = Console.Out;
+        private static bool monitoring_;
+
+        /// <summary>
+        /// Entry point.
+        /// </summary>
+        /// <param name="args">command line arguments, see usage_.</param>
+        /// <returns>0 on success.</returns>
+        public static int Main(string[] args)
+        {
+            int[] sizes = {1000, 10000, 100000};
+            int frames = 10;
+            int width = 800;
+            int height = 600;
+            ArrayList only = null;
+            bool render = true;
+            bool load = true;
+            string output = null;
+            bool compare = false;
+            Equivalence equivalence = new Equivalence();
+            ArrayList paths = new ArrayList(new string[] {"reference"});
+            double[] zooms = {1.0, 10.0};
+
+            try
+            {
+                for (int i = 0; i < args.Length; ++i)
+                {
+                    switch (args[i])
+                    {
+                        case "--sizes":
+                            string[] s = args[++i].Split(',');
+                            sizes = new int[s.Length];
+                            for (int j = 0; j < s.Length; ++j)
+                                sizes[j] = int.Parse(s[j], CultureInfo.InvariantCulture);
+                            break;
+                        case "--frames":
+                            frames = int.Parse(args[++i], CultureInfo.InvariantCulture);
+                            break;
+                        case "--width":
+                            width = int.Parse(args[++i], CultureInfo.InvariantCulture);
+                            break;
+                        case "--height":
+                            height = int.Parse(args[++i], CultureInfo.InvariantCulture);
+                            break;
+                        case "--only":
+                            only = new ArrayList(args[++i].ToLower(CultureInfo.InvariantCulture).Split(','));
+                            break;
+                        case "--no-render":
+                            render = false;
+                            break;
+                        case "--no-load":
+                            load = false;
+                            break;
+                        case "--output":
+                            output = args[++i];
+                            break;
+                        case "--compare":
+                            compare = true;
+                            break;
+                        case "--paths":
+                            paths = new ArrayList(args[++i].ToLower(CultureInfo.InvariantCulture).Split(','));
+                            break;
+                        case "--zooms":
+                            string[] z = args[++i].Split(',');
+                            zooms = new double[z.Length];
+                            for (int j = 0; j < z.Length; ++j)
+                                zooms[j] = double.Parse(z[j], CultureInfo.InvariantCulture);
+                            break;
+                        case "--tolerance":
+                            equivalence.Tolerance = int.Parse(args[++i], CultureInfo.InvariantCulture);
+                            break;
+                        case "--max-differing":
+                            equivalence.MaxDifferingFraction = double.Parse(args[++i], CultureInfo.InvariantCulture);
+                            break;
+                        case "--diff-dir":
+                            equivalence.DiffDirectory = args[++i];
+                            break;
+                        default:
+                            throw new ArgumentException(args[i]);
+                    }
+                }
+            }
+            catch (Exception)
+            {
+                Console.Error.WriteLine(usage_);
+                return 1;
+            }
+
+            // allocation counts are not available on all runtimes.
+            try
+            {
+                AppDomain.MonitoringIsEnabled = true;
+                monitoring_ = true;
+            }
+            catch (NotImplementedException)
+            {
+                monitoring_ = false;
+            }
+
+            if (output != null)
+            {
+                out_ = new StreamWriter(output);
+            }
+
+            if (compare)
+            {
+                equivalence.Frames = frames;
+                int result = Compare(equivalence, paths, zooms, only, sizes, width, height);
+                out_.Flush();
+                if (output != null)
+                {
+                    out_.Close();
+                }
+                return result;
+            }
+
+            out_.WriteLine("benchmark,size,iterations,ms_per_iteration,min_ms,points_per_sec,bytes_per_iteration");
+
+            if (render)
+            {
+                foreach (Scenarios.Scenario scenario in Scenarios.All)
+                {
+                    if (only != null && !only.Contains(scenario.Name.ToLower(CultureInfo.InvariantCulture)))
+                        continue;
+
+                    foreach (int size in sizes)
+                    {
+                        NPlot.Bitmap.PlotSurface2D surface = new NPlot.Bitmap.PlotSurface2D(width, height);
+                        scenario.Setup(surface, size);
+                        Measure(scenario.Name, size, frames, surface.Refresh);
+                        surface.Bitmap.Dispose();
+                    }
+                }
+            }
+
+            if (load)
+            {
+                foreach (int size in sizes)
+                {
+                    LoadBenchmark lb = new LoadBenchmark(size);
+                    try
+                    {
+                        if (only == null || only.Contains("loadxml"))
+                            Measure("LoadXml", size, frames, lb.LoadXml);
+                        if (only == null || only.Contains("loadcsv"))
+                            Measure("LoadCsv", size, frames, lb.LoadCsv);
+                        if (only == null || only.Contains("loadbinary"))
+                            Measure("LoadBinary", size, frames, lb.LoadBinary);
+                    }
+                    finally
+                    {
+                        lb.Delete();
+                    }
+                }
+            }
+
+            out_.Flush();
+            if (output != null)
+            {
+                out_.Close();
+            }
+
+            return 0;
+        }
+
+        /// <summary>
+        /// Checks each selected path on each selected scenario, at each zoom.
+        /// </summary>
+        /// <returns>0 if all pass, 1 otherwise.</returns>
+        private static int Compare(Equivalence equivalence, ArrayList paths, double[] zooms, ArrayList only,
+                                   int[] sizes, int width, int height)
+        {
+            Equivalence.WriteHeader(out_);
+
+            bool pass = true;
+            foreach (Equivalence.Path path in Equivalence.Paths)
+            {
+                if (!paths.Contains(path.Name))
+                    continue;
+
+                foreach (double zoom in zooms)
+                {
+                    equivalence.Zoom = zoom;
+
+                    foreach (Scenarios.Scenario scenario in Scenarios.All)
+                    {
+                        if (only != null && !only.Contains(scenario.Name.ToLower(CultureInfo.InvariantCulture)))
+                            continue;
+
+                        foreach (int size in sizes)
+                        {
+                            pass &= equivalence.Check(out_, scenario, size, path, width, height);
+                        }
+                    }
+
+                    // the demo plots have fixed data.
+                    foreach (Scenarios.Scenario scenario in DemoScenarios.All)
+                    {
+                        if (only != null && !only.Contains(scenario.Name.ToLower(CultureInfo.InvariantCulture)))
+                            continue;
+
+                        pass &= equivalence.Check(out_, scenario, 0, path, width, height);
+                    }
+                }
+            }
+
+            return pass ? 0 : 1;
+        }
+
+        /// <summary>
+        /// Total bytes allocated so far, or -1 if this can't be found.
+        /// </summary>
+        private static long AllocatedBytes()
+        {
+            if (!monitoring_)
+                return -1;
+            return AppDomain.CurrentDomain.MonitoringTotalAllocatedMemorySize;
+        }
+
+        /// <summary>
+        /// Times an operation and writes a line of results.
+        /// </summary>
+        /// <param name="name">name of the benchmark.</param>
+        /// <param name="size">number of data points the operation handles.</param>
+        /// <param name="iterations">number of timed runs of the operation.</param>
+        /// <param name="op">the operation.</param>
+        private static void Measure(string name, int size, int iterations, Operation op)
+        {
+            // the first run pays for JIT compilation and caches.
+            op();
+
+            GC.Collect();
+            GC.WaitForPendingFinalizers();
+            GC.Collect();
+
+            long allocatedBefore = AllocatedBytes();
+
+            Stopwatch sw = new Stopwatch();
+            double total = 0.0;
+            double min = Double.MaxValue;
+            for (int i = 0; i < iterations; ++i)
+            {
+                sw.Reset();
+                sw.Start();
+                op();
+                sw.Stop();
+                double ms = sw.Elapsed.TotalMilliseconds;
+                total += ms;
+                min = Math.Min(min, ms);
+            }
+
+            long allocated = -1;
+            if (allocatedBefore >= 0)
+            {
+                allocated = (AllocatedBytes() - allocatedBefore)/iterations;
+            }
+
+            double mean = total/iterations;
+            double pointsPerSecond = mean > 0.0 ? size/(mean/1000.0) : 0.0;
+
+            out_.WriteLine(String.Format(CultureInfo.InvariantCulture,
+                                         "{0},{1},{2},{3:0.###},{4:0.###},{5:0},{6}",
+                                         name, size, iterations, mean, min, pointsPerSecond, allocated));
+            out_.Flush();
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,433 @@
+/*
+ * NPlot - A charting library for .NET
+ * 
+ * Scenarios.cs
+ * Copyright (C) 2003-2006 Matt Howlett and others.
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+using System;
+using System.Data;
+using System.Drawing;
+using NPlot;
+
+namespace NPlotBenchmark
+{
+    /// <summary>
+    /// Sets up a plot surface for one scenario with the given amount of data.
+    /// </summary>
+    public delegate void ScenarioSetup(NPlot.Bitmap.PlotSurface2D surface, int size);
+
+    /// <summary>
+    /// The rendering scenarios. Each follows one of the PlotSurface2DDemo plot
+    /// routines, with the amount of data as a parameter. Data is generated from
+    /// a fixed seed so that runs are comparable.
+    /// </summary>
+    public class Scenarios
+    {
+        /// <summary>
+        /// A named scenario.
+        /// </summary>
+        public class Scenario
+        {
+            /// <summary>
+            /// Constructor
+            /// </summary>
+            /// <param name="name">name of the scenario.</param>
+            /// <param name="setup">method that sets up a plot surface for it.</param>
+            public Scenario(string name, ScenarioSetup setup)
+            {
+                Name = name;
+                Setup = setup;
+            }
+
+            /// <summary>
+            /// Name of the scenario, used in the results.
+            /// </summary>
+            public string Name { get; private set; }
+
+            /// <summary>
+            /// Sets up a plot surface for the scenario.
+            /// </summary>
+            public ScenarioSetup Setup { get; private set; }
+        }
+
+        /// <summary>
+        /// All of the scenarios.
+        /// </summary>
+        public static readonly Scenario[] All =
+            {
+                new Scenario("PlotWave", PlotWave),
+                new Scenario("PlotLine", PlotLine),
+                new Scenario("PlotParticles", PlotParticles),
+                new Scenario("PlotDataSet", PlotDataSet),
+                new Scenario("PlotCandle", PlotCandle),
+                new Scenario("PlotImage", PlotImage),
+                new Scenario("PlotLogLog", PlotLogLog),
+                new Scenario("PlotMultiHistogram", PlotMultiHistogram),
+                new Scenario("PlotMultiLine", PlotMultiLine),
+                new Scenario("PlotLabels", PlotLabels)
+            };
+
+        /// <summary>
+        /// StepPlot of a sound wave, with a horizontal line, on a coloured background.
+        /// </summary>
+        public static void PlotWave(NPlot.Bitmap.PlotSurface2D surface, int size)
+        {
+            Random r = new Random(0);
+            short[] w = new short[size];
+            for (int i = 0; i < size; ++i)
+            {
+                w[i] = (short) (8000*Math.Sin(i*0.05)*Math.Sin(i*0.0011) + r.Next(-500, 500));
+            }
+
+            surface.Add(new HorizontalLine(0.0, Color.LightBlue));
+
+            StepPlot sp = new StepPlot();
+            sp.DataSource = w;
+            sp.Color = Color.Yellow;
+            sp.Center = true;
+            surface.Add(sp);
+
+            surface.YAxis1.FlipTicksLabel = true;
+            surface.PlotBackColor = Color.DarkBlue;
+            surface.BackColor = Color.Black;
+        }
+
+        /// <summary>
+        /// LinePlot of a noisy sine wave against sorted abscissa values.
+        /// </summary>
+        public static void PlotLine(NPlot.Bitmap.PlotSurface2D surface, int size)
+        {
+            Random r = new Random(0);
+            double[] x = new double[size];
+            double[] y = new double[size];
+            for (int i = 0; i < size; ++i)
+            {
+                x[i] = i*0.01;
+                y[i] = Math.Sin(x[i]) + 0.1*r.NextDouble();
+            }
+
+            LinePlot lp = new LinePlot(y, x);
+            lp.AbscissaSorted = true;
+            lp.Color = Color.Blue;
+            surface.Add(lp);
+        }
+
+        /// <summary>
+        /// PointPlot of particles distributed in an ellipse, on a fine grid.
+        /// </summary>
+        public static void PlotParticles(NPlot.Bitmap.PlotSurface2D surface, int size)
+        {
+            Grid grid = new Grid();
+            grid.HorizontalGridType = Grid.GridType.Fine;
+            grid.VerticalGridType = Grid.GridType.Fine;
+            surface.Add(grid);
+
+            const float alpha = -2.0f;
+            const float beta = 1.0f;
+            const float emit = 4.0f;
+            float gamma = (1.0f + alpha*alpha)/beta;
+            float da = -alpha/gamma;
+            float xmax = (float) Math.Sqrt(emit/gamma);
+            float xpmax = (float) Math.Sqrt(emit*gamma);
+
+            Random r = new Random(0);
+            float[] x = new float[size];
+            float[] y = new float[size];
+            for (int i = 0; i < size; ++i)
+            {
+                float d;
+                do
+                {
+                    x[i] = (float) (2.0*r.NextDouble() - 1.0);
+                    y[i] = (float) (2.0*r.NextDouble() - 1.0);
+                    d = x[i]*x[i] + y[i]*y[i];
+                } while (d > 1.0f);
+
+                y[i] *= xpmax;
+                x[i] = x[i]*xmax + y[i]*da;
+            }
+
+            PointPlot pp = new PointPlot();
+            pp.OrdinateData = y;
+            pp.AbscissaData = x;
+            pp.Marker = new Marker(Marker.MarkerType.FilledCircle, 4, new Pen(Color.Blue));
+            surface.Add(pp);
+        }
+
+        /// <summary>
+        /// Random walk share prices.
+        /// </summary>
+        private static OhlcvData Prices(int size)
+        {
+            Random r = new Random(0);
+            double[] date = new double[size];
+            double[] open = new double[size];
+            double[] high = new double[size];
+            double[] low = new double[size];
+            double[] close = new double[size];
+            double[] volume = new double[size];
+
+            DateTime start = new DateTime(2000, 1, 3);
+            double price = 10.0;
+            for (int i = 0; i < size; ++i)
+            {
+                date[i] = start.AddDays(i).Ticks;
+                open[i] = price;
+                price *= 1.0 + 0.02*(r.NextDouble() - 0.5);
+                close[i] = price;
+                high[i] = Math.Max(open[i], close[i])*(1.0 + 0.01*r.NextDouble());
+                low[i] = Math.Min(open[i], close[i])*(1.0 - 0.01*r.NextDouble());
+                volume[i] = r.Next(1000, 1000000);
+            }
+
+            return new OhlcvData(date, open, high, low, close, volume);
+        }
+
+        /// <summary>
+        /// As PlotDataSet in the demo: CandlePlot from a DataTable, with a 10 day moving
+        /// average and a filled region between two standard deviation bands, worked out
+        /// by RollingIndicators.
+        /// </summary>
+        public static void PlotDataSet(NPlot.Bitmap.PlotSurface2D surface, int size)
+        {
+            OhlcvData prices = Prices(size);
+
+            DataTable dt = new DataTable("asx_jbh");
+            dt.Columns.Add("Date", typeof (DateTime));
+            dt.Columns.Add("Open", typeof (float));
+            dt.Columns.Add("Low", typeof (float));
+            dt.Columns.Add("High", typeof (float));
+            dt.Columns.Add("Close", typeof (float));
+            for (int i = 0; i < size; ++i)
+            {
+                dt.Rows.Add(new DateTime((long) prices.Date[i]),
+                            (float) prices.Open[i], (float) prices.Low[i],
+                            (float) prices.High[i], (float) prices.Close[i]);
+            }
+
+            CandlePlot cp = new CandlePlot();
+            cp.DataSource = dt;
+            cp.AbscissaData = "Date";
+            cp.OpenData = "Open";
+            cp.LowData = "Low";
+            cp.HighData = "High";
+            cp.CloseData = "Close";
+            cp.BearishColor = Color.Red;
+            cp.BullishColor = Color.Green;
+            cp.Style = CandlePlot.Styles.Filled;
+
+            LinePlot av = new LinePlot();
+            av.DataSource = dt;
+            av.AbscissaData = "Date";
+            av.OrdinateData = new RollingIndicator(RollingIndicator.IndicatorType.Sma, 10, dt, null, "Close");
+            av.Color = Color.LightGray;
+            av.Pen.Width = 2.0f;
+
+            LinePlot topLine = new LinePlot();
+            topLine.DataSource = dt;
+            topLine.AbscissaData = "Date";
+            topLine.OrdinateData = new RollingIndicator(RollingIndicator.IndicatorType.UpperBand, 10, dt, null, "Close");
+            topLine.Color = Color.LightSteelBlue;
+            topLine.Pen.Width = 2.0f;
+
+            LinePlot bottomLine = new LinePlot();
+            bottomLine.DataSource = dt;
+            bottomLine.AbscissaData = "Date";
+            bottomLine.OrdinateData = new RollingIndicator(RollingIndicator.IndicatorType.LowerBand, 10, dt, null, "Close");
+            bottomLine.Color = Color.LightSteelBlue;
+            bottomLine.Pen.Width = 2.0f;
+
+            FilledRegion fr = new FilledRegion(topLine, bottomLine);
+            fr.RectangleBrush = new RectangleBrushes.Vertical(Color.FromArgb(255, 255, 240), Color.FromArgb(240, 255, 255));
+
+            surface.Add(fr);
+            surface.Add(new Grid());
+            surface.Add(av);
+            surface.Add(topLine);
+            surface.Add(bottomLine);
+            surface.Add(cp);
+        }
+
+        /// <summary>
+        /// CandlePlot straight from OhlcvData.
+        /// </summary>
+        public static void PlotCandle(NPlot.Bitmap.PlotSurface2D surface, int size)
+        {
+            CandlePlot cp = new CandlePlot();
+            cp.DataSource = Prices(size);
+            cp.AbscissaData = "Date";
+            cp.OpenData = "Open";
+            cp.LowData = "Low";
+            cp.HighData = "High";
+            cp.CloseData = "Close";
+            cp.Style = CandlePlot.Styles.Filled;
+            surface.Add(cp);
+        }
+
+        /// <summary>
+        /// ImagePlot of a square map with about size cells.
+        /// </summary>
+        public static void PlotImage(NPlot.Bitmap.PlotSurface2D surface, int size)
+        {
+            int side = Math.Max(1, (int) Math.Sqrt(size));
+            double[,] map = new double[side,side];
+            for (int i = 0; i < side; ++i)
+            {
+                for (int j = 0; j < side; ++j)
+                {
+                    double x = (i - side/2.0)/side;
+                    double y = (j - side/2.0)/side;
+                    map[i, j] = Math.Exp(-(x*x + y*y)*8.0);
+                }
+            }
+
+            ImagePlot ip = new ImagePlot(map, -9.0f, 1.0f, -9.0f, 1.0f);
+            ip.Gradient = new LinearGradient(Color.Gold, Color.Black);
+            surface.Add(ip);
+        }
+
+        /// <summary>
+        /// LinePlot of a power law against log axes.
+        /// </summary>
+        public static void PlotLogLog(NPlot.Bitmap.PlotSurface2D surface, int size)
+        {
+            Grid grid = new Grid();
+            grid.HorizontalGridType = Grid.GridType.Fine;
+            grid.VerticalGridType = Grid.GridType.Fine;
+            surface.Add(grid);
+
+            double[] x = new double[size];
+            double[] y = new double[size];
+            double step = 10.0/size;
+            for (int i = 0; i < size; ++i)
+            {
+                x[i] = (i + 1)*step;
+                y[i] = x[i]*x[i];
+            }
+
+            LinePlot lp = new LinePlot(y, x);
+            lp.AbscissaSorted = true;
+            lp.Pen = new Pen(Color.Red);
+            surface.Add(lp);
+
+            LogAxis logx = new LogAxis(surface.XAxis1);
+            logx.WorldMin = x[0];
+            logx.WorldMax = x[size - 1];
+            logx.LargeTickStep = 1.0f;
+            surface.XAxis1 = logx;
+
+            LogAxis logy = new LogAxis(surface.YAxis1);
+            logy.WorldMin = y[0];
+            logy.WorldMax = y[size - 1];
+            logy.LargeTickStep = 1.0f;
+            surface.YAxis1 = logy;
+        }
+
+        /// <summary>
+        /// Two filled HistogramPlots side by side on a gradient background.
+        /// </summary>
+        public static void PlotMultiHistogram(NPlot.Bitmap.PlotSurface2D surface, int size)
+        {
+            Random r = new Random(0);
+            double[] data = new double[size];
+            double[] data2 = new double[size];
+            for (int i = 0; i < size; ++i)
+            {
+                data[i] = r.Next(0, 6);
+                data2[i] = r.Next(0, 6);
+            }
+
+            HistogramPlot hp = new HistogramPlot();
+            hp.OrdinateData = data;
+            hp.RectangleBrush = RectangleBrushes.Horizontal.FaintRedFade;
+            hp.Filled = true;
+            hp.BaseOffset = -0.15;
+            hp.BaseWidth = 0.25f;
+
+            HistogramPlot hp2 = new HistogramPlot();
+            hp2.OrdinateData = data2;
+            hp2.RectangleBrush = RectangleBrushes.Horizontal.FaintGreenFade;
+            hp2.Filled = true;
+            hp2.BaseOffset = 0.15;
+            hp2.BaseWidth = 0.25f;
+
+            surface.Add(hp);
+            surface.Add(hp2);
+            surface.PlotBackBrush = RectangleBrushes.Vertical.FaintBlueFade;
+        }
+
+        /// <summary>
+        /// MultiLinePlot of 16 channels sharing a time column in a DataTable.
+        /// </summary>
+        public static void PlotMultiLine(NPlot.Bitmap.PlotSurface2D surface, int size)
+        {
+            Random r = new Random(0);
+            DataTable table = new DataTable();
+            table.Columns.Add("Time", typeof (double));
+            for (int c = 0; c < 16; ++c)
+            {
+                table.Columns.Add("Channel" + c, typeof (double));
+            }
+
+            object[] row = new object[17];
+            for (int i = 0; i < size; ++i)
+            {
+                row[0] = i*0.01;
+                for (int c = 0; c < 16; ++c)
+                {
+                    row[c + 1] = c + Math.Sin(i*0.01 + c) + 0.1*r.NextDouble();
+                }
+                table.Rows.Add(row);
+            }
+
+            MultiLinePlot mlp = new MultiLinePlot(table, "Time");
+            mlp.AbscissaSorted = true;
+            surface.Add(mlp);
+        }
+
+        /// <summary>
+        /// LabelPointPlot of a scatter with a label on every point.
+        /// </summary>
+        public static void PlotLabels(NPlot.Bitmap.PlotSurface2D surface, int size)
+        {
+            Random r = new Random(0);
+            double[] x = new double[size];
+            double[] y = new double[size];
+            string[] text = new string[size];
+            for (int i = 0; i < size; ++i)
+            {
+                x[i] = r.NextDouble();
+                y[i] = r.NextDouble();
+                text[i] = "P" + i;
+            }
+
+            LabelPointPlot lpp = new LabelPointPlot(new Marker(Marker.MarkerType.FilledCircle, 4, Color.Blue));
+            lpp.OrdinateData = y;
+            lpp.AbscissaData = x;
+            lpp.TextData = text;
+            surface.Add(lpp);
+        }
+    }
+}
\ No newline at end of file
@@ -48,6 +48,7 @@ namespace NPlotDemo
 	{
         private NPlot.Windows.PlotSurface2D volumePS;
         private NPlot.Windows.PlotSurface2D costPS;
+        private NPlot.Windows.AxisLinkGroup dateLink;
         private System.Windows.Forms.Button closeButton;
 
 
@@ -117,7 +118,6 @@ namespace NPlotDemo
             costPS.AddInteraction(new NPlot.Windows.PlotSurface2D.Interactions.HorizontalDrag());
             costPS.AddInteraction(new NPlot.Windows.PlotSurface2D.Interactions.VerticalDrag());
             costPS.AddInteraction(new NPlot.Windows.PlotSurface2D.Interactions.AxisDrag(false));
-            costPS.InteractionOccured += new NPlot.Windows.PlotSurface2D.InteractionHandler(costPS_InteractionOccured);
             costPS.AddAxesConstraint(new AxesConstraint.AxisPosition(PlotSurface2D.YAxisPosition.Left, 60));
 
             PointPlot pp = new PointPlot();
@@ -134,10 +134,17 @@ namespace NPlotDemo
             volumePS.AddAxesConstraint(new AxesConstraint.AxisPosition(PlotSurface2D.YAxisPosition.Left, 60));
             volumePS.AddInteraction(new NPlot.Windows.PlotSurface2D.Interactions.AxisDrag(false));
             volumePS.AddInteraction(new NPlot.Windows.PlotSurface2D.Interactions.HorizontalDrag());
-            volumePS.InteractionOccured += new NPlot.Windows.PlotSurface2D.InteractionHandler(volumePS_InteractionOccured);
+            volumePS.XAxis1.Label = "Date / Time";
             volumePS.PreRefresh += new NPlot.Windows.PlotSurface2D.PreRefreshHandler(volumePS_PreRefresh);
 
             this.costPS.RightMenu = new ReducedContextMenu();
+
+            // keep the date axes of the two charts in step. Both are repainted
+            // together once per frame, whichever one is being dragged.
+            this.dateLink = new NPlot.Windows.AxisLinkGroup();
+            this.dateLink.Add(costPS);
+            this.dateLink.Add(volumePS);
+            this.dateLink.RangeChanged(costPS);
 			
         }
 
@@ -238,33 +245,6 @@ namespace NPlotDemo
 		}
 
 
-        /// <summary>
-        /// When the costPS chart has changed, this is called which updates the volumePS chart.
-        /// </summary>
-        /// <param name="sender"></param>
-        private void costPS_InteractionOccured(object sender)
-        {
-            DateTimeAxis axis = new DateTimeAxis(costPS.XAxis1);
-            axis.Label = "Date / Time";
-            axis.HideTickText = false;
-            this.volumePS.XAxis1 = axis;
-            this.volumePS.Refresh();
-        }
-
-
-        /// <summary>
-        /// When the volumePS chart has changed, this is called which updates hte costPS chart.
-        /// </summary>
-        private void volumePS_InteractionOccured(object sender)
-        {
-            DateTimeAxis axis = new DateTimeAxis(volumePS.XAxis1);
-            axis.Label = "";
-            axis.HideTickText = true;
-            this.costPS.XAxis1 = axis;
-            this.costPS.Refresh();
-        }
-
-
         /// <summary>
         /// This is called prior to volumePS refresh to enforce the WorldMin is 0. 
         /// This may have been changed by the axisdrag interaction.
@@ -78,6 +78,105 @@ namespace NPlot
             }
         }
 
+        /// <summary>
+        /// Provides axis suggestion for a column held in a DataColumnCache. The
+        /// extents are calculated when the column is cached.
+        /// </summary>
+        public class AxisSuggester_CachedColumn : IAxisSuggester
+        {
+            private readonly DataColumnCache.Column column_;
+
+            /// <summary>
+            /// Constructor
+            /// </summary>
+            /// <param name="column">the cached column to suggest an axis for.</param>
+            public AxisSuggester_CachedColumn(DataColumnCache.Column column)
+            {
+                column_ = column;
+            }
+
+            /// <summary>
+            /// Calculates a suggested axis given the data specified in the constructor.
+            /// </summary>
+            /// <returns>the suggested axis</returns>
+            public Axis Get()
+            {
+                if (column_.HasExtents)
+                {
+                    if (column_.IsDateTime)
+                    {
+                        return new DateTimeAxis(column_.Min, column_.Max);
+                    }
+
+                    else
+                    {
+                        return new LinearAxis(column_.Min, column_.Max);
+                    }
+                }
+
+                return new LinearAxis(0.0, 1.0);
+            }
+        }
+
+        /// <summary>
+        /// Provides axis suggestion for data in a column of a range of rows of a
+        /// ColumnarFile. The extents recorded in the file header are used, or for a
+        /// sorted column the first and last values in the range, so at most two
+        /// values are read.
+        /// </summary>
+        public class AxisSuggester_ColumnarFile : IAxisSuggester
+        {
+            private readonly ColumnarFile.Column column_;
+            private readonly long first_;
+            private readonly int count_;
+
+            /// <summary>
+            /// Constructor
+            /// </summary>
+            /// <param name="rows">the range of rows of the ColumnarFile that contains the data.</param>
+            /// <param name="columnName">the column of interest in the file, or null if
+            /// an axis suitable for the row indices is required.</param>
+            public AxisSuggester_ColumnarFile(ColumnarFile.RowRange rows, string columnName)
+            {
+                if (columnName != null)
+                    column_ = rows.File[columnName];
+                first_ = rows.First;
+                count_ = rows.Count;
+            }
+
+            /// <summary>
+            /// Calculates a suggested axis given the data specified in the constructor.
+            /// </summary>
+            /// <returns>the suggested axis</returns>
+            public Axis Get()
+            {
+                if (count_ == 0)
+                {
+                    return new LinearAxis(0.0, 1.0);
+                }
+
+                if (column_ == null)
+                {
+                    return new LinearAxis(0, count_ - 1);
+                }
+
+                double min = column_.Min;
+                double max = column_.Max;
+                if (column_.Sorted)
+                {
+                    min = column_.Get(first_);
+                    max = column_.Get(first_ + count_ - 1);
+                }
+
+                if (column_.Type == ColumnarFile.ColumnType.DateTime)
+                {
+                    return new DateTimeAxis(min, max);
+                }
+
+                return new LinearAxis(min, max);
+            }
+        }
+
         /// <summary>
         /// Provides axis suggestion for data in a particular column of a DataView.
         /// </summary>
@@ -322,6 +421,51 @@ namespace NPlot
             }
         }
 
+        /// <summary>
+        /// Provides axis suggestion for the values of a RollingIndicator. All of the
+        /// values are worked out in doing so.
+        /// </summary>
+        public class AxisSuggester_RollingIndicator : IAxisSuggester
+        {
+            private readonly RollingIndicator indicator_;
+
+            /// <summary>
+            /// Constructor
+            /// </summary>
+            /// <param name="indicator">the indicator to suggest an axis for.</param>
+            public AxisSuggester_RollingIndicator(RollingIndicator indicator)
+            {
+                indicator_ = indicator;
+            }
+
+            /// <summary>
+            /// Calculates a suggested axis given the data specified in the constructor.
+            /// </summary>
+            /// <returns>the suggested axis</returns>
+            public Axis Get()
+            {
+                double min = double.NaN;
+                double max = double.NaN;
+                for (int i = 0; i < indicator_.Count; ++i)
+                {
+                    double e = indicator_[i];
+                    if (double.IsNaN(e))
+                        continue;
+                    if (double.IsNaN(min) || e < min)
+                        min = e;
+                    if (double.IsNaN(max) || e > max)
+                        max = e;
+                }
+
+                if (double.IsNaN(min))
+                {
+                    return new LinearAxis(0.0, 1.0);
+                }
+
+                return new LinearAxis(min, max);
+            }
+        }
+
         /// <summary>
         /// This class gets an axis corresponding to a StartStep object. The data on
         /// the orthogonal axis is of course also needed to calculate this.
@@ -378,6 +522,33 @@ namespace NPlot
 
         #region Counters
 
+        /// <summary>
+        /// Class that provides the number of rows in a range of rows of a ColumnarFile
+        /// via the ICounter interface.
+        /// </summary>
+        public class Counter_ColumnarFile : ICounter
+        {
+            private readonly ColumnarFile.RowRange rows_;
+
+            /// <summary>
+            /// Constructor
+            /// </summary>
+            /// <param name="rows">the range of rows to provide count of number of rows of.</param>
+            public Counter_ColumnarFile(ColumnarFile.RowRange rows)
+            {
+                rows_ = rows;
+            }
+
+            /// <summary>
+            /// Number of data items in container.
+            /// </summary>
+            /// <value>Number of data items in container.</value>
+            public int Count
+            {
+                get { return rows_.Count; }
+            }
+        }
+
         /// <summary>
         /// Class that provides the number of items in a DataView via the ICounter interface.
         /// </summary>
@@ -487,11 +658,71 @@ namespace NPlot
 
         #region DataGetters
 
+        /// <summary>
+        /// Provides data in a column of a range of rows of a ColumnarFile via the
+        /// IDataGetter interface. If the column is sorted, ISortedDataGetter is
+        /// supported too.
+        /// </summary>
+        public class DataGetter_ColumnarFile : ISortedDataGetter
+        {
+            private readonly ColumnarFile.Column column_;
+            private readonly long first_;
+
+            /// <summary>
+            /// Constructor
+            /// </summary>
+            /// <param name="rows">the range of rows of the ColumnarFile to get data from.</param>
+            /// <param name="columnName">Get data in this column</param>
+            public DataGetter_ColumnarFile(ColumnarFile.RowRange rows, string columnName)
+            {
+                column_ = rows.File[columnName];
+                first_ = rows.First;
+            }
+
+            /// <summary>
+            /// True if the values in the column are in ascending order.
+            /// </summary>
+            public bool Sorted
+            {
+                get { return column_.Sorted; }
+            }
+
+            /// <summary>
+            /// Gets the ith data value.
+            /// </summary>
+            /// <param name="i">sequence number of data to get.</param>
+            /// <returns>ith data value.</returns>
+            public double Get(int i)
+            {
+                return column_.Get(first_ + i);
+            }
+
+            /// <summary>
+            /// Finds the index of the first value greater than (or equal to) the given value.
+            /// </summary>
+            /// <param name="value">the value to search for.</param>
+            /// <param name="count">the number of data values.</param>
+            /// <param name="orEqual">if true, find the first value greater than or equal to value.</param>
+            /// <returns>the index found, or count if there is none.</returns>
+            public int Search(double value, int count, bool orEqual)
+            {
+                return AdapterUtils.Search(this, value, count, orEqual);
+            }
+        }
+
         /// <summary>
         /// Provides the natural numbers (and 0) via the IDataGetter interface.
         /// </summary>
-        public class DataGetter_Count : IDataGetter
+        public class DataGetter_Count : ISortedDataGetter
         {
+            /// <summary>
+            /// True, the natural numbers are in ascending order.
+            /// </summary>
+            public bool Sorted
+            {
+                get { return true; }
+            }
+
             /// <summary>
             /// Gets the ith data value.
             /// </summary>
@@ -501,6 +732,18 @@ namespace NPlot
             {
                 return i;
             }
+
+            /// <summary>
+            /// Finds the index of the first value greater than (or equal to) the given value.
+            /// </summary>
+            /// <param name="value">the value to search for.</param>
+            /// <param name="count">the number of data values.</param>
+            /// <param name="orEqual">if true, find the first value greater than or equal to value.</param>
+            /// <returns>the index found, or count if there is none.</returns>
+            public int Search(double value, int count, bool orEqual)
+            {
+                return SearchNear(this, value, count, orEqual, value);
+            }
         }
 
         /// <summary>
@@ -684,10 +927,39 @@ namespace NPlot
             }
         }
 
+        /// <summary>
+        /// Provides the values of a RollingIndicator via the IDataGetter interface.
+        /// </summary>
+        public class DataGetter_RollingIndicator : IDataGetter
+        {
+            private readonly RollingIndicator indicator_;
+
+            /// <summary>
+            /// Constructor
+            /// </summary>
+            /// <param name="indicator">the indicator to get values from.</param>
+            public DataGetter_RollingIndicator(RollingIndicator indicator)
+            {
+                indicator_ = indicator;
+            }
+
+            /// <summary>
+            /// Gets the ith data value.
+            /// </summary>
+            /// <param name="i">sequence number of data to get.</param>
+            /// <returns>ith data value.</returns>
+            public double Get(int i)
+            {
+                return indicator_[i];
+            }
+        }
+
         /// <summary>
         /// Provides data points from a StartStep object via the IDataGetter interface.
+        /// The data is sorted if Step is positive, in which case searches are
+        /// calculated rather than performed.
         /// </summary>
-        public class DataGetter_StartStep : IDataGetter
+        public class DataGetter_StartStep : ISortedDataGetter
         {
             private readonly StartStep data_;
 
@@ -709,6 +981,26 @@ namespace NPlot
             {
                 return data_.Start + (i)*data_.Step;
             }
+
+            /// <summary>
+            /// True if the data points are in ascending order.
+            /// </summary>
+            public bool Sorted
+            {
+                get { return data_.Step > 0.0; }
+            }
+
+            /// <summary>
+            /// Finds the index of the first value greater than (or equal to) the given value.
+            /// </summary>
+            /// <param name="value">the value to search for.</param>
+            /// <param name="count">the number of data values.</param>
+            /// <param name="orEqual">if true, find the first value greater than or equal to value.</param>
+            /// <returns>the index found, or count if there is none.</returns>
+            public int Search(double value, int count, bool orEqual)
+            {
+                return SearchNear(this, value, count, orEqual, (value - data_.Start)/data_.Step);
+            }
         }
 
         /// <summary>
@@ -727,6 +1019,79 @@ namespace NPlot
             double Get(int i);
         }
 
+        /// <summary>
+        /// Interface for data holding classes whose values may be known to be in
+        /// ascending order. This allows the range of indices corresponding to a world
+        /// interval to be found without visiting every value.
+        /// </summary>
+        public interface ISortedDataGetter : IDataGetter
+        {
+            /// <summary>
+            /// True if the values are in ascending order. Search is only meaningful
+            /// if this is true.
+            /// </summary>
+            bool Sorted { get; }
+
+            /// <summary>
+            /// Finds the index of the first value greater than (or equal to) the given value.
+            /// </summary>
+            /// <param name="value">the value to search for.</param>
+            /// <param name="count">the number of data values.</param>
+            /// <param name="orEqual">if true, find the first value greater than or equal to value.</param>
+            /// <returns>the index found, or count if there is none.</returns>
+            int Search(double value, int count, bool orEqual);
+        }
+
+        /// <summary>
+        /// Binary searches data in ascending order for the first value greater than
+        /// (or equal to) the given value.
+        /// </summary>
+        /// <param name="data">the data to search. Values must be in ascending order and not NaN.</param>
+        /// <param name="value">the value to search for.</param>
+        /// <param name="count">the number of data values.</param>
+        /// <param name="orEqual">if true, find the first value greater than or equal to value.</param>
+        /// <returns>the index found, or count if there is none.</returns>
+        public static int Search(IDataGetter data, double value, int count, bool orEqual)
+        {
+            int lo = 0;
+            int hi = count;
+            while (lo < hi)
+            {
+                int mid = lo + (hi - lo)/2;
+                double v = data.Get(mid);
+                if (v > value || (orEqual && v == value))
+                    hi = mid;
+                else
+                    lo = mid + 1;
+            }
+            return lo;
+        }
+
+        /// <summary>
+        /// As Search, but for data whose index corresponding to value can be
+        /// estimated. The estimate is only corrected for rounding error, so it
+        /// must be within a few places of the answer.
+        /// </summary>
+        private static int SearchNear(IDataGetter data, double value, int count, bool orEqual, double estimate)
+        {
+            if (Double.IsNaN(estimate))
+                return count;
+
+            int i;
+            if (estimate <= 0.0)
+                i = 0;
+            else if (estimate >= count)
+                i = count;
+            else
+                i = (int) estimate;
+
+            while (i < count && !(data.Get(i) > value || (orEqual && data.Get(i) == value)))
+                ++i;
+            while (i > 0 && (data.Get(i - 1) > value || (orEqual && data.Get(i - 1) == value)))
+                --i;
+            return i;
+        }
+
         #endregion
     }
 }
\ No newline at end of file
@@ -756,6 +756,73 @@ namespace NPlot
             return new PointF((_physicalMin.X + offset.X), (_physicalMin.Y + offset.Y));
         }
 
+        /// <summary>
+        /// World to physical coordinate transform of many values at once. The result
+        /// is the same as calling WorldToPhysical with clip false for each value, but
+        /// everything that does not depend on the value is worked out only once.
+        /// </summary>
+        /// <param name="coords">The coordinate values to transform.</param>
+        /// <param name="start">Index in coords of the first value to transform.</param>
+        /// <param name="count">The number of values to transform.</param>
+        /// <param name="physicalMin">The physical position corresponding to the world minimum of the axis.</param>
+        /// <param name="physicalMax">The physical position corresponding to the world maximum of the axis.</param>
+        /// <param name="x">If not null, receives the physical x positions, starting at index 0.</param>
+        /// <param name="y">If not null, receives the physical y positions, starting at index 0.</param>
+        public virtual void WorldToPhysical(
+            double[] coords, int start, int count,
+            PointF physicalMin, PointF physicalMax,
+            float[] x, float[] y)
+        {
+            if (!IsLinear)
+            {
+                // derived non-linear axes that don't supply their own version.
+                for (int i = 0; i < count; ++i)
+                {
+                    PointF p = WorldToPhysical(coords[start + i], physicalMin, physicalMax, false);
+                    if (x != null)
+                        x[i] = p.X;
+                    if (y != null)
+                        y[i] = p.Y;
+                }
+                return;
+            }
+
+            if (Reversed)
+            {
+                PointF tmp = physicalMin;
+                physicalMin = physicalMax;
+                physicalMax = tmp;
+            }
+
+            float physicalX = physicalMax.X - physicalMin.X;
+            float physicalY = physicalMax.Y - physicalMin.Y;
+
+            double worldMin = WorldMin;
+            double range = WorldMax - worldMin;
+
+            const double largeClip = 100.0;
+
+            for (int i = 0; i < count; ++i)
+            {
+                double coord = coords[start + i];
+                double prop = ((coord - worldMin)/range);
+
+                if (range == 0)
+                {
+                    if (coord >= worldMin)
+                        prop = largeClip;
+
+                    if (coord < worldMin)
+                        prop = -largeClip;
+                }
+
+                if (x != null)
+                    x[i] = physicalMin.X + (float) (prop*physicalX);
+                if (y != null)
+                    y[i] = physicalMin.Y + (float) (prop*physicalY);
+            }
+        }
+
         /// <summary>
         /// Return the world coordinate of the projection of the point p onto
         /// the axis.
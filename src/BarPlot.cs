@@ -117,18 +117,24 @@ namespace NPlot
 
             ITransform2D t = Transform2D.GetTransformer(xAxis, yAxis);
 
-            for (int i = 0; i < dataTop.Count; ++i)
+            // one brush fitted to each bar in turn, rather than a new brush per bar
+            // (except on the reference path).
+            using (RectangleBrushCache brushes = new RectangleBrushCache(rectangleBrush_))
             {
-                PointF physicalBottom = t.Transform(dataBottom[i]);
-                PointF physicalTop = t.Transform(dataTop[i]);
-
-                if (physicalBottom != physicalTop)
+                IRectangleBrush fill = xAxis.ReferencePath ? rectangleBrush_ : brushes;
+                for (int i = 0; i < dataTop.Count; ++i)
                 {
-                    Rectangle r = new Rectangle((int) (physicalBottom.X - BarWidth/2), (int) physicalTop.Y,
-                                                (int) BarWidth, (int) (physicalBottom.Y - physicalTop.Y));
+                    PointF physicalBottom = t.Transform(dataBottom[i]);
+                    PointF physicalTop = t.Transform(dataTop[i]);
+
+                    if (physicalBottom != physicalTop)
+                    {
+                        Rectangle r = new Rectangle((int) (physicalBottom.X - BarWidth/2), (int) physicalTop.Y,
+                                                    (int) BarWidth, (int) (physicalBottom.Y - physicalTop.Y));
 
-                    g.FillRectangle(rectangleBrush_.Get(r), r);
-                    g.DrawRectangle(borderPen_, r);
+                        g.FillRectangle(fill.Get(r), r);
+                        g.DrawRectangle(borderPen_, r);
+                    }
                 }
             }
         }
@@ -37,6 +37,14 @@ namespace NPlot
     /// <remarks>If C# had multiple inheritance, the heirachy would be different. The way it is isn't very nice.</remarks>
     public class BaseSequencePlot : BasePlot, ISequencePlot
     {
+        private PointIndex pointIndex_;
+        private object[] pointIndexSource_;
+
+        private double[] worldX_;
+        private double[] worldY_;
+        private float[] physicalX_;
+        private float[] physicalY_;
+
         /// <summary>
         /// Gets or sets the data, or column name for the ordinate [y] axis.
         /// </summary>
@@ -47,6 +55,82 @@ namespace NPlot
         /// </summary>
         public object AbscissaData { get; set; }
 
+        /// <summary>
+        /// Set this to true if the abscissa data is known to be in ascending order
+        /// and contains no NaN values. This allows the data in view to be found by
+        /// binary search, rather than by considering every point, which makes drawing
+        /// a small part of a large data set fast. Abscissa data that is a StartStep,
+        /// or is not specified, is known to be sorted regardless.
+        /// </summary>
+        public bool AbscissaSorted { get; set; }
+
+        /// <summary>
+        /// A spatial index of the data points of the plot, used to find the point
+        /// nearest to a physical position. It is built when first needed, and again
+        /// if the data properties are set or the number of points changes. Call
+        /// InvalidatePointIndex if data values are changed in place.
+        /// </summary>
+        public PointIndex PointIndex
+        {
+            get
+            {
+                SequenceAdapter data_ =
+                    new SequenceAdapter(DataSource, DataMember, OrdinateData, AbscissaData, AbscissaSorted);
+
+                object[] source = {DataSource, DataMember, OrdinateData, AbscissaData, data_.Count};
+
+                bool same = pointIndex_ != null;
+                for (int i = 0; same && i < source.Length; ++i)
+                {
+                    same = Equals(source[i], pointIndexSource_[i]);
+                }
+
+                if (!same)
+                {
+                    pointIndex_ = new PointIndex(data_);
+                    pointIndexSource_ = source;
+                }
+
+                return pointIndex_;
+            }
+        }
+
+        /// <summary>
+        /// Discards the spatial index of the data points, so that it is rebuilt
+        /// the next time it is needed.
+        /// </summary>
+        public void InvalidatePointIndex()
+        {
+            pointIndex_ = null;
+        }
+
+        /// <summary>
+        /// Gets scratch arrays of at least count elements in which to transform a run
+        /// of points. They are kept between draws, and only grown, so that drawing a
+        /// large series does not allocate every time.
+        /// </summary>
+        /// <param name="count">the number of points to be transformed.</param>
+        /// <param name="worldX">world x coordinates.</param>
+        /// <param name="worldY">world y coordinates.</param>
+        /// <param name="physicalX">physical x coordinates.</param>
+        /// <param name="physicalY">physical y coordinates.</param>
+        protected void GetTransformBuffers(int count,
+                                           out double[] worldX, out double[] worldY,
+                                           out float[] physicalX, out float[] physicalY)
+        {
+            if (worldX_ == null || worldX_.Length < count)
+            {
+                worldX_ = new double[count];
+                worldY_ = new double[count];
+                physicalX_ = new float[count];
+                physicalY_ = new float[count];
+            }
+            worldX = worldX_;
+            worldY = worldY_;
+            physicalX = physicalX_;
+            physicalY = physicalY_;
+        }
+
         /// <summary>
         /// Writes text data of the plot object to the supplied string builder. It is
         /// possible to specify that only data in the specified range be written.
@@ -57,7 +141,7 @@ namespace NPlot
         public void WriteData(StringBuilder sb, RectangleD region, bool onlyInRegion)
         {
             SequenceAdapter data_ =
-                new SequenceAdapter(DataSource, DataMember, OrdinateData, AbscissaData);
+                new SequenceAdapter(DataSource, DataMember, OrdinateData, AbscissaData, AbscissaSorted);
 
             sb.Append("Label: ");
             sb.Append(Label);
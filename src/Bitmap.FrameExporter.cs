@@ -0,0 +1,350 @@
+/*
+ * NPlot - A charting library for .NET
+ * 
+ * Bitmap.FrameExporter.cs
+ * Copyright (C) 2003-2006 Matt Howlett and others.
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+using System;
+using System.Collections;
+using System.Drawing.Imaging;
+using System.Globalization;
+using System.IO;
+using System.Threading;
+
+namespace NPlot
+{
+    namespace Bitmap
+    {
+        /// <summary>
+        /// Puts a plot surface into the state for one frame of an export, for
+        /// example by moving the axes along to the next window of data.
+        /// </summary>
+        /// <param name="surface">the surface to set up.</param>
+        /// <param name="frame">the number of the frame, starting at 0.</param>
+        public delegate void FrameSetup(PlotSurface2D surface, int frame);
+
+        /// <summary>
+        /// Exports a sequence of frames of a plot surface as images, encoding them on
+        /// worker threads while the next frames are rendered.
+        /// </summary>
+        /// <remarks>
+        /// Frames are rendered one after another on the calling thread, into a small
+        /// pool of bitmaps that are reused. Each rendered bitmap is handed to one of the
+        /// encoder threads, and goes back to the pool once it has been written out. So
+        /// no more than PoolSize frames are in flight at a time, however many frames
+        /// there are. Encoding (which for PNG takes about as long as rendering) then
+        /// overlaps with rendering and uses the other cores.
+        /// </remarks>
+        public class FrameExporter
+        {
+            private readonly PlotSurface2D surface_;
+
+            // state of the export in progress. free_, rendered_, finished_ and error_
+            // are guarded by lock_; pending_ and nextToWrite_ by writeLock_.
+            private readonly object lock_ = new object();
+            private readonly object writeLock_ = new object();
+            private Stack free_;
+            private Queue rendered_;
+            private bool finished_;
+            private Exception error_;
+            private Hashtable pending_;
+            private int nextToWrite_;
+            private string pathFormat_;
+            private Stream stream_;
+            private ImageFormat format_;
+
+            /// <summary>
+            /// A frame on its way through the export.
+            /// </summary>
+            private class Frame
+            {
+                public int Index;
+                public System.Drawing.Bitmap Bitmap;
+                public byte[] Data;
+            }
+
+            /// <summary>
+            /// Constructor.
+            /// </summary>
+            /// <param name="surface">
+            /// The surface to export frames of. Frames are the size of its bitmap.
+            /// </param>
+            public FrameExporter(PlotSurface2D surface)
+            {
+                surface_ = surface;
+                Encoders = Math.Max(1, Environment.ProcessorCount - 1);
+                PoolSize = Encoders + 2;
+                ImageFormat = ImageFormat.Png;
+            }
+
+            /// <summary>
+            /// The number of bitmaps to render into, which is also the greatest number of
+            /// frames rendered but not yet written out.
+            /// </summary>
+            public int PoolSize { get; set; }
+
+            /// <summary>
+            /// The number of encoder threads.
+            /// </summary>
+            public int Encoders { get; set; }
+
+            /// <summary>
+            /// The format to encode the frames in. PNG by default.
+            /// </summary>
+            public ImageFormat ImageFormat { get; set; }
+
+            /// <summary>
+            /// Renders and encodes frames to a file each.
+            /// </summary>
+            /// <param name="frameCount">number of frames.</param>
+            /// <param name="setup">called to set up the surface before each frame is rendered. May be null.</param>
+            /// <param name="pathFormat">
+            /// format of the file names, given the frame number, for example "frame{0:00000}.png".
+            /// </param>
+            public void Export(int frameCount, FrameSetup setup, string pathFormat)
+            {
+                pathFormat_ = pathFormat;
+                stream_ = null;
+                Run(frameCount, setup);
+            }
+
+            /// <summary>
+            /// Renders and encodes frames, and writes them one after the other, in order,
+            /// to a stream. This suits, for example, a pipe to a video encoder reading images.
+            /// </summary>
+            /// <param name="frameCount">number of frames.</param>
+            /// <param name="setup">called to set up the surface before each frame is rendered. May be null.</param>
+            /// <param name="stream">the stream to write to.</param>
+            public void Export(int frameCount, FrameSetup setup, Stream stream)
+            {
+                pathFormat_ = null;
+                stream_ = stream;
+                Run(frameCount, setup);
+            }
+
+            private void Run(int frameCount, FrameSetup setup)
+            {
+                if (PoolSize < 1 || Encoders < 1)
+                {
+                    throw new NPlotException("FrameExporter needs at least one bitmap and one encoder.");
+                }
+
+                format_ = ImageFormat;
+                free_ = new Stack();
+                rendered_ = new Queue();
+                finished_ = false;
+                error_ = null;
+                pending_ = new Hashtable();
+                nextToWrite_ = 0;
+
+                // same pixel format as the surface's own bitmap, unless that can not be drawn on.
+                PixelFormat pixelFormat = surface_.Bitmap.PixelFormat;
+                if ((pixelFormat & PixelFormat.Indexed) != 0)
+                {
+                    pixelFormat = PixelFormat.Format32bppArgb;
+                }
+
+                System.Drawing.Bitmap[] pool = new System.Drawing.Bitmap[PoolSize];
+                Thread[] encoders = new Thread[Encoders];
+                try
+                {
+                    for (int i = 0; i < pool.Length; ++i)
+                    {
+                        pool[i] = new System.Drawing.Bitmap(surface_.Width, surface_.Height, pixelFormat);
+                        free_.Push(pool[i]);
+                    }
+
+                    for (int i = 0; i < encoders.Length; ++i)
+                    {
+                        encoders[i] = new Thread(Encode);
+                        encoders[i].IsBackground = true;
+                        encoders[i].Name = "NPlot frame encoder " + i;
+                        encoders[i].Start();
+                    }
+
+                    for (int i = 0; i < frameCount; ++i)
+                    {
+                        Frame frame = new Frame();
+                        frame.Index = i;
+
+                        lock (lock_)
+                        {
+                            while (free_.Count == 0 && error_ == null)
+                                Monitor.Wait(lock_);
+                            if (error_ != null)
+                                break;
+                            frame.Bitmap = (System.Drawing.Bitmap) free_.Pop();
+                        }
+
+                        if (setup != null)
+                        {
+                            setup(surface_, i);
+                        }
+                        // pool bitmaps still hold an earlier frame.
+                        surface_.Render(frame.Bitmap, true);
+
+                        lock (lock_)
+                        {
+                            rendered_.Enqueue(frame);
+                            Monitor.PulseAll(lock_);
+                        }
+                    }
+                }
+                catch (Exception e)
+                {
+                    Fail(e);
+                }
+                finally
+                {
+                    lock (lock_)
+                    {
+                        finished_ = true;
+                        Monitor.PulseAll(lock_);
+                    }
+                    for (int i = 0; i < encoders.Length; ++i)
+                    {
+                        if (encoders[i] != null)
+                            encoders[i].Join();
+                    }
+                    for (int i = 0; i < pool.Length; ++i)
+                    {
+                        if (pool[i] != null)
+                            pool[i].Dispose();
+                    }
+                }
+
+                if (error_ != null)
+                {
+                    throw new NPlotException("Frame export failed: " + error_.Message, error_);
+                }
+            }
+
+            /// <summary>
+            /// Encoder thread. Encodes rendered frames until there are no more.
+            /// </summary>
+            private void Encode()
+            {
+                MemoryStream buffer = new MemoryStream();
+
+                while (true)
+                {
+                    Frame frame;
+                    bool failed;
+                    lock (lock_)
+                    {
+                        while (rendered_.Count == 0 && !finished_)
+                            Monitor.Wait(lock_);
+                        if (rendered_.Count == 0)
+                            return;
+                        frame = (Frame) rendered_.Dequeue();
+                        failed = error_ != null;
+                    }
+
+                    if (!failed)
+                    {
+                        try
+                        {
+                            if (stream_ == null)
+                            {
+                                frame.Bitmap.Save(String.Format(CultureInfo.InvariantCulture, pathFormat_, frame.Index), format_);
+                            }
+                            else
+                            {
+                                buffer.SetLength(0);
+                                frame.Bitmap.Save(buffer, format_);
+                                frame.Data = buffer.ToArray();
+                            }
+                        }
+                        catch (Exception e)
+                        {
+                            Fail(e);
+                            failed = true;
+                        }
+                    }
+
+                    if (stream_ == null || failed)
+                    {
+                        Release(frame);
+                    }
+                    else
+                    {
+                        WriteInOrder(frame);
+                    }
+                }
+            }
+
+            /// <summary>
+            /// Writes out an encoded frame, and any after it that were waiting for it.
+            /// </summary>
+            private void WriteInOrder(Frame frame)
+            {
+                lock (writeLock_)
+                {
+                    pending_[frame.Index] = frame;
+                    while (pending_.Contains(nextToWrite_))
+                    {
+                        Frame next = (Frame) pending_[nextToWrite_];
+                        pending_.Remove(nextToWrite_);
+                        ++nextToWrite_;
+                        try
+                        {
+                            stream_.Write(next.Data, 0, next.Data.Length);
+                        }
+                        catch (Exception e)
+                        {
+                            Fail(e);
+                        }
+                        Release(next);
+                    }
+                }
+            }
+
+            /// <summary>
+            /// Returns a frame's bitmap to the pool.
+            /// </summary>
+            private void Release(Frame frame)
+            {
+                lock (lock_)
+                {
+                    free_.Push(frame.Bitmap);
+                    Monitor.PulseAll(lock_);
+                }
+            }
+
+            /// <summary>
+            /// Records the first error, which stops the export.
+            /// </summary>
+            private void Fail(Exception e)
+            {
+                lock (lock_)
+                {
+                    if (error_ == null)
+                        error_ = e;
+                    Monitor.PulseAll(lock_);
+                }
+            }
+        }
+    }
+}
\ No newline at end of file
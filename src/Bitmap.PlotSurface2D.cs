@@ -26,11 +26,13 @@
  * OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+using System;
 using System.Collections;
 using System.Drawing;
 using System.Drawing.Drawing2D;
 using System.Drawing.Imaging;
 using System.IO;
+using System.Runtime.InteropServices;
 
 namespace NPlot
 {
@@ -67,6 +69,22 @@ namespace NPlot
                 ps_ = new NPlot.PlotSurface2D();
             }
 
+            /// <summary>
+            /// Constructor. The plot is rendered straight into the given pixel memory,
+            /// which must stay valid (and if managed, pinned) for the life of the
+            /// surface. It is not copied, and is not freed when Bitmap is disposed.
+            /// </summary>
+            /// <param name="width">width of the image in pixels.</param>
+            /// <param name="height">height of the image in pixels.</param>
+            /// <param name="stride">bytes from the start of one row to the start of the next.</param>
+            /// <param name="format">the pixel format of the memory. Must not be indexed.</param>
+            /// <param name="scan0">the address of the first pixel of the first row.</param>
+            public PlotSurface2D(int width, int height, int stride, PixelFormat format, IntPtr scan0)
+            {
+                b_ = WrapPixels(width, height, stride, format, scan0);
+                ps_ = new NPlot.PlotSurface2D();
+            }
+
             /// <summary>
             /// The bitmap width
             /// </summary>
@@ -261,6 +279,15 @@ namespace NPlot
                 set { ps_.PlotBackBrush = value; }
             }
 
+            /// <summary>
+            /// Discards the kept plot background, so that it is drawn again. Needed only
+            /// if the PlotBackImage bitmap is modified in place.
+            /// </summary>
+            public void InvalidatePlotBackground()
+            {
+                ps_.InvalidatePlotBackground();
+            }
+
             /// <summary>
             /// Smoothing mode to use when drawing plots.
             /// </summary>
@@ -357,22 +384,156 @@ namespace NPlot
             public MemoryStream ToStream(ImageFormat imageFormat)
             {
                 MemoryStream stream = new MemoryStream();
-                ps_.Draw(Graphics.FromImage(Bitmap), new Rectangle(0, 0, b_.Width, b_.Height));
+                using (Graphics g = Graphics.FromImage(Bitmap))
+                {
+                    ps_.Draw(g, new Rectangle(0, 0, b_.Width, b_.Height));
+                }
                 Bitmap.Save(stream, imageFormat);
                 return stream;
             }
 
+            /// <summary>
+            /// How much effort to put into drawing. See NPlot.PlotSurface2D.Quality.
+            /// </summary>
+            public DrawQuality Quality
+            {
+                get { return ps_.Quality; }
+                set { ps_.Quality = value; }
+            }
+
+            /// <summary>
+            /// The size in pixels of the detail that drawables may leave out when Quality
+            /// is DrawQuality.Preview.
+            /// </summary>
+            public int PreviewDecimation
+            {
+                get { return ps_.PreviewDecimation; }
+                set { ps_.PreviewDecimation = value; }
+            }
+
+            /// <summary>
+            /// If true, the surface is drawn without the optimizations that should not
+            /// change what is drawn. See NPlot.PlotSurface2D.ReferencePath.
+            /// </summary>
+            public bool ReferencePath
+            {
+                get { return ps_.ReferencePath; }
+                set { ps_.ReferencePath = value; }
+            }
+
+            /// <summary>
+            /// Raised after each draw with the time taken by each phase of it.
+            /// See NPlot.PlotSurface2D.Rendered.
+            /// </summary>
+            public event NPlot.PlotSurface2D.RenderedHandler Rendered
+            {
+                add { ps_.Rendered += value; }
+                remove { ps_.Rendered -= value; }
+            }
+
             /// <summary>
             /// Refreshes (draws) the plot.
             /// </summary>
             public void Refresh()
             {
-                if (backColor_ != null)
+                Render(b_);
+            }
+
+            /// <summary>
+            /// Draws the plot straight into pixel memory owned by the caller, for example
+            /// a frame buffer of a video encoder or a shared memory display, without
+            /// copying it through Bitmap. The memory is only used during the call.
+            /// </summary>
+            /// <param name="scan0">the address of the first pixel of the first row.</param>
+            /// <param name="width">width of the image in pixels.</param>
+            /// <param name="height">height of the image in pixels.</param>
+            /// <param name="stride">bytes from the start of one row to the start of the next.</param>
+            /// <param name="format">the pixel format of the memory. Must not be indexed.</param>
+            public void RenderTo(IntPtr scan0, int width, int height, int stride, PixelFormat format)
+            {
+                using (System.Drawing.Bitmap target = WrapPixels(width, height, stride, format, scan0))
+                {
+                    Render(target);
+                }
+            }
+
+            /// <summary>
+            /// Draws the plot straight into an array of 32 bit ARGB pixels, rows one after
+            /// the other. The array is pinned only for the duration of the call.
+            /// </summary>
+            /// <param name="pixels">the pixels, at least width * height of them.</param>
+            /// <param name="width">width of the image in pixels.</param>
+            /// <param name="height">height of the image in pixels.</param>
+            public void RenderTo(int[] pixels, int width, int height)
+            {
+                if (pixels.Length < (long) width*height)
+                {
+                    throw new NPlotException("Pixel array is smaller than width * height.");
+                }
+
+                GCHandle handle = GCHandle.Alloc(pixels, GCHandleType.Pinned);
+                try
+                {
+                    RenderTo(handle.AddrOfPinnedObject(), width, height, width*4, PixelFormat.Format32bppArgb);
+                }
+                finally
+                {
+                    handle.Free();
+                }
+            }
+
+            /// <summary>
+            /// Draws the plot and writes it in the given format straight to a stream,
+            /// without going through a MemoryStream as ToStream does.
+            /// </summary>
+            /// <param name="stream">the stream to write to.</param>
+            /// <param name="imageFormat">the format to write in.</param>
+            public void Save(Stream stream, ImageFormat imageFormat)
+            {
+                Render(b_);
+                b_.Save(stream, imageFormat);
+            }
+
+            internal void Render(System.Drawing.Bitmap target)
+            {
+                Render(target, false);
+            }
+
+            /// <summary>
+            /// Draws the plot into target. If clear is true and there is no BackColor,
+            /// the target is cleared to transparent first, so nothing previously drawn
+            /// in it shows outside the plot area.
+            /// </summary>
+            internal void Render(System.Drawing.Bitmap target, bool clear)
+            {
+                using (Graphics g = Graphics.FromImage(target))
+                {
+                    if (backColor_ != null)
+                    {
+                        using (Brush b = new SolidBrush((Color) backColor_))
+                        {
+                            g.FillRectangle(b, 0, 0, target.Width, target.Height);
+                        }
+                    }
+                    else if (clear)
+                    {
+                        g.Clear(Color.Transparent);
+                    }
+                    ps_.Draw(g, new Rectangle(0, 0, target.Width, target.Height));
+                }
+            }
+
+            private static System.Drawing.Bitmap WrapPixels(int width, int height, int stride, PixelFormat format, IntPtr scan0)
+            {
+                if ((format & PixelFormat.Indexed) != 0)
+                {
+                    throw new NPlotException("Can not draw into an indexed pixel format.");
+                }
+                if (scan0 == IntPtr.Zero)
                 {
-                    Graphics g = Graphics.FromImage(b_);
-                    g.FillRectangle((new Pen((Color) backColor_)).Brush, 0, 0, b_.Width, b_.Height);
+                    throw new NPlotException("Pixel memory address is null.");
                 }
-                ps_.Draw(Graphics.FromImage(b_), new Rectangle(0, 0, b_.Width, b_.Height));
+                return new System.Drawing.Bitmap(width, height, stride, format, scan0);
             }
         }
     }
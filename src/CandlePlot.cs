@@ -128,8 +128,10 @@ namespace NPlot
         /// </summary>
         public Styles Style = Styles.Filled;
 
+        private AggregationCache aggregationCache_;
         private bool centered_ = true;
         private Color color_ = Color.Black;
+        private int minCandleSpacing_ = 3;
         private int stickWidth_ = AutoScaleStickWidth;
 
         /// <summary>
@@ -196,6 +198,41 @@ namespace NPlot
             set { centered_ = value; }
         }
 
+        /// <summary>
+        /// When there are more candles in view than can be drawn this number of pixels
+        /// apart, neighbouring candles are merged (first open, highest high, lowest low,
+        /// last close) into as few coarser candles as necessary, so the chart stays
+        /// readable and cheap to draw. The merged candles are cached. Set to 0 to always
+        /// draw every candle. Default is 3.
+        /// </summary>
+        /// <remarks>
+        /// Aggregation is only done if the abscissa values are in ascending order.
+        /// The cache is rebuilt when the data objects (or, for a DataTable, its
+        /// contents) change, except that if the new data only adds candles to the end
+        /// of the old, just the merged candles they fall in are recomputed. If data
+        /// arrays are modified in place, call ClearAggregationCache.
+        /// </remarks>
+        public int MinCandleSpacing
+        {
+            get { return minCandleSpacing_; }
+            set
+            {
+                if (value < 0)
+                {
+                    throw new NPlotException("Minimum candle spacing must not be negative.");
+                }
+                minCandleSpacing_ = value;
+            }
+        }
+
+        /// <summary>
+        /// Discards the cached aggregated candles (see MinCandleSpacing).
+        /// </summary>
+        public void ClearAggregationCache()
+        {
+            aggregationCache_ = null;
+        }
+
         /// <summary>
         /// Draws the candle plot on a GDI+ surface agains the provided x and y axes.
         /// </summary>
@@ -207,6 +244,13 @@ namespace NPlot
             CandleDataAdapter cd = new CandleDataAdapter(DataSource, DataMember,
                                                          AbscissaData, OpenData, LowData, HighData, CloseData);
 
+            int first = 0;
+            int last = cd.Count - 1;
+            if (cd.Count > 1)
+            {
+                cd = VisibleCandles(cd, xAxis, ref first, ref last);
+            }
+
             Brush bearishBrush = new SolidBrush(BearishColor);
             Brush bullishBrush = new SolidBrush(BullishColor);
 
@@ -242,7 +286,7 @@ namespace NPlot
 			}
 			*/
 
-            for (int i = 0; i < cd.Count; ++i)
+            for (int i = first; i <= last; ++i)
             {
                 PointOLHC point = cd[i];
                 if ((!double.IsNaN(point.Open)) && (!double.IsNaN(point.High)) && (!double.IsNaN(point.Low)) && (!double.IsNaN(point.Close)))
@@ -349,6 +393,66 @@ namespace NPlot
         {
         }
 
+        /// <summary>
+        /// Chooses the level of aggregation appropriate for the visible range, and
+        /// finds the range of candles at that level that are in view. If the
+        /// abscissa values are not in ascending order, neither can be done and the
+        /// data is returned as is. On an axis drawing by the reference path, the
+        /// levels are aggregated afresh and all candles at the level are drawn.
+        /// </summary>
+        /// <param name="cd">Candle adapter containing the data.</param>
+        /// <param name="xAxis">Physical x axis the data is plotted against.</param>
+        /// <param name="first">Set to the first candle to draw.</param>
+        /// <param name="last">Set to the last candle to draw.</param>
+        /// <returns>Candle adapter containing the candles to draw.</returns>
+        private CandleDataAdapter VisibleCandles(CandleDataAdapter cd, PhysicalAxis xAxis, ref int first, ref int last)
+        {
+            AggregationCache cache = aggregationCache_;
+            object[] key = cd.SourceKey();
+            if (cache == null || xAxis.ReferencePath || !cache.Matches(key) && !cache.Extend(cd, key))
+            {
+                cache = new AggregationCache(cd, key);
+                aggregationCache_ = cache;
+            }
+
+            if (!cache.Sorted)
+            {
+                return cd;
+            }
+
+            double leftCutoff = xAxis.PhysicalToWorld(xAxis.PhysicalMin, false);
+            double rightCutoff = xAxis.PhysicalToWorld(xAxis.PhysicalMax, false);
+            if (leftCutoff > rightCutoff)
+            {
+                Utils.Swap(ref leftCutoff, ref rightCutoff);
+            }
+
+            int level = 0;
+            if (minCandleSpacing_ > 0)
+            {
+                AdapterUtils.IDataGetter x = cache.X(0);
+                int visible = AdapterUtils.Search(x, rightCutoff, cd.Count, false) -
+                              AdapterUtils.Search(x, leftCutoff, cd.Count, true);
+                float width = Math.Abs(xAxis.PhysicalMax.X - xAxis.PhysicalMin.X);
+
+                while ((visible >> level)*(float) minCandleSpacing_ > width && (cd.Count >> (level + 1)) > 1)
+                {
+                    ++level;
+                }
+            }
+
+            CandleDataAdapter candles = cache.Level(level);
+            if (xAxis.ReferencePath)
+            {
+                first = 0;
+                last = candles.Count - 1;
+                return candles;
+            }
+            first = Math.Max(AdapterUtils.Search(cache.X(level), leftCutoff, candles.Count, true) - 1, 0);
+            last = Math.Min(AdapterUtils.Search(cache.X(level), rightCutoff, candles.Count, false), candles.Count - 1);
+            return candles;
+        }
+
         /// <summary>
         /// Calculates the physical (not world) separation between abscissa values.
         /// </summary>
@@ -390,6 +494,7 @@ namespace NPlot
         {
             private readonly double[] abscissaDataArray_;
             private readonly object abscissaData_;
+            private readonly DataColumnCache.Column abscissaColumn_;
             private readonly double[] closeDataArray_;
             private readonly object closeData_;
 
@@ -398,9 +503,11 @@ namespace NPlot
             private readonly double[] highDataArray_;
             private readonly object highData_;
             private readonly double[] lowDataArray_;
+            private readonly DataColumnCache.Column lowColumn_;
             private readonly object lowData_;
             private readonly double[] openDataArray_;
             private readonly object openData_;
+            private readonly DataColumnCache.Column highColumn_;
             private readonly DataRowCollection rows_;
             private readonly bool useDoublesArrays_;
 
@@ -427,45 +534,91 @@ namespace NPlot
                 dataSource_ = dataSource;
                 dataMember_ = dataMember;
 
-                if (dataSource_ != null)
+                DataTable table = null;
+                OhlcvData ohlcv = dataSource_ as OhlcvData;
+
+                if (dataSource_ != null && ohlcv == null)
                 {
                     if (dataSource_ is DataSet)
                     {
                         if (dataMember_ != null)
                         {
-                            rows_ = (((DataSet) dataSource_).Tables[dataMember_]).Rows;
+                            table = ((DataSet) dataSource_).Tables[dataMember_];
                         }
                         else
                         {
-                            rows_ = (((DataSet) dataSource_).Tables[0]).Rows;
+                            table = ((DataSet) dataSource_).Tables[0];
                         }
                     }
 
                     else if (dataSource_ is DataTable)
                     {
-                        rows_ = ((DataTable) dataSource_).Rows;
+                        table = (DataTable) dataSource_;
                     }
 
                     else
                     {
                         throw new NPlotException("not implemented yet");
                     }
+
+                    rows_ = table.Rows;
+                }
+
+                if ((table != null || ohlcv != null) && abscissaData_ is string && openData_ is string &&
+                    lowData_ is string && highData_ is string && closeData_ is string)
+                {
+                    // extract the columns once, rather than converting every value on every draw.
+                    abscissaColumn_ = ColumnOf(table, ohlcv, (string) abscissaData_);
+                    lowColumn_ = ColumnOf(table, ohlcv, (string) lowData_);
+                    highColumn_ = ColumnOf(table, ohlcv, (string) highData_);
+
+                    abscissaDataArray_ = abscissaColumn_.Data;
+                    openDataArray_ = ColumnOf(table, ohlcv, (string) openData_).Data;
+                    lowDataArray_ = lowColumn_.Data;
+                    highDataArray_ = highColumn_.Data;
+                    closeDataArray_ = ColumnOf(table, ohlcv, (string) closeData_).Data;
+                }
+                else
+                {
+                    openDataArray_ = openData_ as Double[];
+                    lowDataArray_ = lowData_ as Double[];
+                    highDataArray_ = highData_ as Double[];
+                    closeDataArray_ = closeData_ as Double[];
+                    abscissaDataArray_ = abscissaData_ as Double[];
                 }
 
-                openDataArray_ = openData_ as Double[];
-                lowDataArray_ = lowData_ as Double[];
-                highDataArray_ = highData_ as Double[];
-                closeDataArray_ = closeData_ as Double[];
-                abscissaDataArray_ = abscissaData_ as Double[];
                 useDoublesArrays_ = (
                                         openDataArray_ != null &&
                                         lowDataArray_ != null &&
                                         highDataArray_ != null &&
-                                        lowDataArray_ != null &&
+                                        closeDataArray_ != null &&
                                         abscissaDataArray_ != null
                                     );
             }
 
+            /// <summary>
+            /// Objects identifying the data, used to tell whether data derived from it is stale.
+            /// </summary>
+            internal object[] SourceKey()
+            {
+                return new object[]
+                    {
+                        abscissaDataArray_ ?? abscissaData_,
+                        openDataArray_ ?? openData_,
+                        lowDataArray_ ?? lowData_,
+                        highDataArray_ ?? highData_,
+                        closeDataArray_ ?? closeData_,
+                        Count
+                    };
+            }
+
+            private static DataColumnCache.Column ColumnOf(DataTable table, OhlcvData ohlcv, string columnName)
+            {
+                if (table != null)
+                    return DataColumnCache.Get(table, columnName);
+                return ohlcv[columnName];
+            }
+
             /// <summary>
             /// Gets the ith point in the candle adapter
             /// </summary>
@@ -475,45 +628,50 @@ namespace NPlot
             {
                 get
                 {
-                    // try a fast track first
-                    if (useDoublesArrays_)
-                    {
-                        return new PointOLHC(
-                            abscissaDataArray_[i],
-                            openDataArray_[i],
-                            lowDataArray_[i],
-                            highDataArray_[i],
-                            closeDataArray_[i]);
-                    }
-
-                        // is the data coming from a data source?
-                    else if (rows_ != null)
-                    {
-                        double x = Utils.ToDouble(((rows_[i]))[(string) abscissaData_]);
-                        double open = Utils.ToDouble(((rows_[i]))[(string) openData_]);
-                        double low = Utils.ToDouble(((rows_[i]))[(string) lowData_]);
-                        double high = Utils.ToDouble(((rows_[i]))[(string) highData_]);
-                        double close = Utils.ToDouble(((rows_[i]))[(string) closeData_]);
+                    double x, open, low, high, close;
+                    Get(i, out x, out open, out low, out high, out close);
+                    return new PointOLHC(x, open, low, high, close);
+                }
+            }
 
-                        return new PointOLHC(x, open, low, high, close);
-                    }
+            /// <summary>
+            /// Gets the values of the ith datapoint without creating a PointOLHC.
+            /// </summary>
+            internal void Get(int i, out double x, out double open, out double low, out double high, out double close)
+            {
+                // try a fast track first
+                if (useDoublesArrays_)
+                {
+                    x = abscissaDataArray_[i];
+                    open = openDataArray_[i];
+                    low = lowDataArray_[i];
+                    high = highDataArray_[i];
+                    close = closeDataArray_[i];
+                }
 
-                        // the data is coming from individual arrays.
-                    else if (abscissaData_ is Array && openData_ is Array && lowData_ is Array && highData_ is Array && closeData_ is Array)
-                    {
-                        double x = Utils.ToDouble(((Array) abscissaData_).GetValue(i));
-                        double open = Utils.ToDouble(((Array) openData_).GetValue(i));
-                        double low = Utils.ToDouble(((Array) lowData_).GetValue(i));
-                        double high = Utils.ToDouble(((Array) highData_).GetValue(i));
-                        double close = Utils.ToDouble(((Array) closeData_).GetValue(i));
+                    // is the data coming from a data source?
+                else if (rows_ != null)
+                {
+                    x = Utils.ToDouble(((rows_[i]))[(string) abscissaData_]);
+                    open = Utils.ToDouble(((rows_[i]))[(string) openData_]);
+                    low = Utils.ToDouble(((rows_[i]))[(string) lowData_]);
+                    high = Utils.ToDouble(((rows_[i]))[(string) highData_]);
+                    close = Utils.ToDouble(((rows_[i]))[(string) closeData_]);
+                }
 
-                        return new PointOLHC(x, open, low, high, close);
-                    }
+                    // the data is coming from individual arrays.
+                else if (abscissaData_ is Array && openData_ is Array && lowData_ is Array && highData_ is Array && closeData_ is Array)
+                {
+                    x = Utils.ToDouble(((Array) abscissaData_).GetValue(i));
+                    open = Utils.ToDouble(((Array) openData_).GetValue(i));
+                    low = Utils.ToDouble(((Array) lowData_).GetValue(i));
+                    high = Utils.ToDouble(((Array) highData_).GetValue(i));
+                    close = Utils.ToDouble(((Array) closeData_).GetValue(i));
+                }
 
-                    else
-                    {
-                        throw new NPlotException("not implemented yet");
-                    }
+                else
+                {
+                    throw new NPlotException("not implemented yet");
                 }
             }
 
@@ -568,7 +726,7 @@ namespace NPlot
                 double max;
                 double minStep = 0.0;
 
-                if (rows_ == null)
+                if (abscissaColumn_ == null)
                 {
                     Utils.ArrayMinMax((IList) abscissaData_, out min, out max);
 
@@ -596,23 +754,24 @@ namespace NPlot
                 }
                 else
                 {
-                    Utils.RowArrayMinMax(rows_, out min, out max, (string) abscissaData_);
+                    min = abscissaColumn_.Min;
+                    max = abscissaColumn_.Max;
 
-                    if (rows_.Count > 1)
+                    if (abscissaDataArray_.Length > 1)
                     {
-                        double first = Utils.ToDouble(rows_[0][(string) abscissaData_]);
-                        double second = Utils.ToDouble(rows_[1][(string) abscissaData_]);
+                        double first = abscissaDataArray_[0];
+                        double second = abscissaDataArray_[1];
                         minStep = Math.Abs(second - first);
                     }
-                    if (rows_.Count > 2)
+                    if (abscissaDataArray_.Length > 2)
                     {
-                        double first = Utils.ToDouble(rows_[1][(string) abscissaData_]);
-                        double second = Utils.ToDouble(rows_[2][(string) abscissaData_]);
+                        double first = abscissaDataArray_[1];
+                        double second = abscissaDataArray_[2];
                         if (Math.Abs(second - first) < minStep)
                             minStep = Math.Abs(second - first);
                     }
 
-                    if ((rows_[0])[(string) abscissaData_] is DateTime)
+                    if (abscissaColumn_.IsDateTime)
                     {
                         return new DateTimeAxis(min - minStep/2.0, max + minStep/2.0);
                     }
@@ -634,15 +793,17 @@ namespace NPlot
                 double min_h;
                 double max_h;
 
-                if (rows_ == null)
+                if (lowColumn_ == null)
                 {
                     Utils.ArrayMinMax((IList) lowData_, out min_l, out max_l);
                     Utils.ArrayMinMax((IList) highData_, out min_h, out max_h);
                 }
                 else
                 {
-                    Utils.RowArrayMinMax(rows_, out min_l, out max_l, (string) lowData_);
-                    Utils.RowArrayMinMax(rows_, out min_h, out max_h, (string) highData_);
+                    min_l = lowColumn_.Min;
+                    max_l = lowColumn_.Max;
+                    min_h = highColumn_.Min;
+                    max_h = highColumn_.Max;
                 }
 
                 Axis a = new LinearAxis(min_l, max_h);
@@ -679,5 +840,193 @@ namespace NPlot
                 return new Stick();
             }
         }
+
+        /// <summary>
+        /// Candles aggregated into buckets of 2^level consecutive candles, for each
+        /// level that has been required so far. Level 0 is the data itself, which is
+        /// read in place; coarser levels are built when first required.
+        /// </summary>
+        private class AggregationCache
+        {
+            private object[] key_;
+            private readonly ArrayList levels_ = new ArrayList();
+            private readonly ArrayList values_ = new ArrayList();
+            private readonly ArrayList x_ = new ArrayList();
+
+            public AggregationCache(CandleDataAdapter cd, object[] key)
+            {
+                key_ = key;
+                Sorted = IsSorted(cd, 1);
+                levels_.Add(cd);
+                values_.Add(null);
+                x_.Add(new AbscissaGetter(cd));
+            }
+
+            public bool Sorted { get; private set; }
+
+            public bool Matches(object[] key)
+            {
+                for (int i = 0; i < key.Length; ++i)
+                {
+                    if (!ReferenceEquals(key[i], key_[i]) && !Equals(key[i], key_[i]))
+                        return false;
+                }
+                return true;
+            }
+
+            /// <summary>
+            /// If cd is the cached data with candles added to the end, brings the
+            /// cache up to date with it, recomputing only the merged candles that the
+            /// new candles fall in.
+            /// </summary>
+            /// <returns>true if the cache was extended.</returns>
+            public bool Extend(CandleDataAdapter cd, object[] key)
+            {
+                CandleDataAdapter old = (CandleDataAdapter) levels_[0];
+                if (!Sorted || cd.Count <= old.Count)
+                {
+                    return false;
+                }
+
+                for (int i = 0; i < old.Count; ++i)
+                {
+                    double x0, open0, low0, high0, close0;
+                    double x1, open1, low1, high1, close1;
+                    old.Get(i, out x0, out open0, out low0, out high0, out close0);
+                    cd.Get(i, out x1, out open1, out low1, out high1, out close1);
+                    if (!Same(x0, x1) || !Same(open0, open1) || !Same(low0, low1) ||
+                        !Same(high0, high1) || !Same(close0, close1))
+                    {
+                        return false;
+                    }
+                }
+
+                if (!IsSorted(cd, old.Count))
+                {
+                    return false;
+                }
+
+                key_ = key;
+                levels_[0] = cd;
+                x_[0] = new AbscissaGetter(cd);
+
+                // merged candles made only of unchanged candles are unchanged.
+                int unchanged = old.Count;
+                for (int level = 1; level < levels_.Count; ++level)
+                {
+                    unchanged /= 2;
+                    Aggregate(level, (double[][]) values_[level], unchanged);
+                }
+
+                return true;
+            }
+
+            public AdapterUtils.IDataGetter X(int level)
+            {
+                Level(level);
+                return (AdapterUtils.IDataGetter) x_[level];
+            }
+
+            public CandleDataAdapter Level(int level)
+            {
+                while (levels_.Count <= level)
+                {
+                    levels_.Add(null);
+                    values_.Add(null);
+                    x_.Add(null);
+                    Aggregate(levels_.Count - 1, null, 0);
+                }
+                return (CandleDataAdapter) levels_[level];
+            }
+
+            private static bool IsSorted(CandleDataAdapter cd, int start)
+            {
+                double previous = 0.0;
+                for (int i = Math.Max(start, 1) - 1; i < cd.Count; ++i)
+                {
+                    double x, open, low, high, close;
+                    cd.Get(i, out x, out open, out low, out high, out close);
+                    if (i >= start && !(x >= previous))
+                    {
+                        return false;
+                    }
+                    previous = x;
+                }
+                return true;
+            }
+
+            private static bool Same(double a, double b)
+            {
+                return a == b || double.IsNaN(a) && double.IsNaN(b);
+            }
+
+            /// <summary>
+            /// (Re)computes a level from the one below it. The first keep merged
+            /// candles are copied from old, which holds the level's previous values.
+            /// </summary>
+            private void Aggregate(int level, double[][] old, int keep)
+            {
+                CandleDataAdapter previous = (CandleDataAdapter) levels_[level - 1];
+                int count = (previous.Count + 1)/2;
+
+                double[] x = new double[count];
+                double[] open = new double[count];
+                double[] low = new double[count];
+                double[] high = new double[count];
+                double[] close = new double[count];
+
+                if (old != null)
+                {
+                    Array.Copy(old[0], x, keep);
+                    Array.Copy(old[1], open, keep);
+                    Array.Copy(old[2], low, keep);
+                    Array.Copy(old[3], high, keep);
+                    Array.Copy(old[4], close, keep);
+                }
+
+                for (int i = keep; i < count; ++i)
+                {
+                    previous.Get(2*i, out x[i], out open[i], out low[i], out high[i], out close[i]);
+
+                    if (2*i + 1 < previous.Count)
+                    {
+                        double bx, bOpen, bLow, bHigh, bClose;
+                        previous.Get(2*i + 1, out bx, out bOpen, out bLow, out bHigh, out bClose);
+                        if (double.IsNaN(open[i]))
+                            open[i] = bOpen;
+                        if (double.IsNaN(low[i]) || bLow < low[i])
+                            low[i] = bLow;
+                        if (double.IsNaN(high[i]) || bHigh > high[i])
+                            high[i] = bHigh;
+                        if (!double.IsNaN(bClose))
+                            close[i] = bClose;
+                    }
+                }
+
+                levels_[level] = new CandleDataAdapter(null, null, x, open, low, high, close);
+                values_[level] = new double[][] {x, open, low, high, close};
+                x_[level] = new AdapterUtils.DataGetter_DoublesArray(x);
+            }
+        }
+
+        /// <summary>
+        /// Provides the abscissa values of a CandleDataAdapter via the IDataGetter interface.
+        /// </summary>
+        private class AbscissaGetter : AdapterUtils.IDataGetter
+        {
+            private readonly CandleDataAdapter cd_;
+
+            public AbscissaGetter(CandleDataAdapter cd)
+            {
+                cd_ = cd;
+            }
+
+            public double Get(int i)
+            {
+                double x, open, low, high, close;
+                cd_.Get(i, out x, out open, out low, out high, out close);
+                return x;
+            }
+        }
     }
 }
\ No newline at end of file
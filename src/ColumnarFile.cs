@@ -0,0 +1,535 @@
+/*
+ * NPlot - A charting library for .NET
+ * 
+ * ColumnarFile.cs
+ * Copyright (C) 2003-2006 Matt Howlett and others.
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+using System;
+using System.Collections;
+using System.IO;
+using System.IO.MemoryMappedFiles;
+using System.Text;
+
+namespace NPlot
+{
+    /// <summary>
+    /// Provides read access to a binary file of typed data columns via a memory
+    /// mapping. Nothing but the header is read when the file is opened - values are
+    /// paged in by the operating system as they are accessed, so very large series
+    /// can be plotted without loading them. An instance can be used as the DataSource
+    /// of sequence plots, with OrdinateData and AbscissaData set to column names.
+    /// </summary>
+    /// <remarks>
+    /// The file consists of a header followed by one contiguous block of values per
+    /// column. The header holds the row count and, for each column, its name, element
+    /// type, extents, whether it is sorted in ascending order, and the byte offset of
+    /// its block. All values are little endian. Use Write to create a file.
+    ///
+    /// When the abscissa column is sorted, plots only access the rows inside the
+    /// visible world range, so only the pages backing those rows are touched.
+    ///
+    /// Rows are indexed by long, and each column is mapped through a window of
+    /// limited size that is moved as rows outside it are accessed, so neither the
+    /// number of rows nor the size of a column is limited by the address space.
+    /// Plots index their data by int, so a file with more than int.MaxValue rows is
+    /// plotted a RowRange at a time (see Rows). Reading columns is not thread safe.
+    /// </remarks>
+    public class ColumnarFile : IDisposable
+    {
+        /// <summary>
+        /// The element types a column may have.
+        /// </summary>
+        public enum ColumnType
+        {
+            /// <summary>
+            /// 8 byte floating point values.
+            /// </summary>
+            Double = 0,
+
+            /// <summary>
+            /// 4 byte floating point values.
+            /// </summary>
+            Single = 1,
+
+            /// <summary>
+            /// 8 byte signed integers.
+            /// </summary>
+            Int64 = 2,
+
+            /// <summary>
+            /// 4 byte signed integers.
+            /// </summary>
+            Int32 = 3,
+
+            /// <summary>
+            /// DateTime values, stored as 8 byte tick counts.
+            /// </summary>
+            DateTime = 4
+        }
+
+        /// <summary>
+        /// A single column of a ColumnarFile.
+        /// </summary>
+        public class Column
+        {
+            /// <summary>
+            /// The size in bytes of the part of a column mapped at any one time.
+            /// </summary>
+            private const long windowBytes_ = 64L*1024*1024;
+
+            private readonly ColumnarFile owner_;
+            private readonly long rows_;
+            private readonly int size_;
+
+            private MemoryMappedViewAccessor view_;
+            private long viewFirst_;
+            private long viewCount_;
+
+            internal Column(ColumnarFile owner, string name, ColumnType type, bool sorted, double min, double max,
+                            long offset, long rows)
+            {
+                owner_ = owner;
+                Name = name;
+                Type = type;
+                Sorted = sorted;
+                Min = min;
+                Max = max;
+                Offset = offset;
+                rows_ = rows;
+                size_ = SizeOf(type);
+            }
+
+            /// <summary>
+            /// The name of the column.
+            /// </summary>
+            public string Name { get; private set; }
+
+            /// <summary>
+            /// The element type of the column.
+            /// </summary>
+            public ColumnType Type { get; private set; }
+
+            /// <summary>
+            /// True if the values in the column are in ascending order.
+            /// </summary>
+            public bool Sorted { get; private set; }
+
+            /// <summary>
+            /// The minimum value in the column, as recorded in the header. DateTime
+            /// values are expressed in ticks.
+            /// </summary>
+            public double Min { get; private set; }
+
+            /// <summary>
+            /// The maximum value in the column, as recorded in the header. DateTime
+            /// values are expressed in ticks.
+            /// </summary>
+            public double Max { get; private set; }
+
+            /// <summary>
+            /// The byte offset of the column's values in the file.
+            /// </summary>
+            public long Offset { get; private set; }
+
+            /// <summary>
+            /// Gets the ith value in the column as a double. DateTime values are
+            /// returned in ticks.
+            /// </summary>
+            /// <param name="i">index of the value to get.</param>
+            /// <returns>the ith value.</returns>
+            public double Get(long i)
+            {
+                if (i < viewFirst_ || i >= viewFirst_ + viewCount_)
+                {
+                    Map(i);
+                }
+
+                long position = (i - viewFirst_)*size_;
+                switch (Type)
+                {
+                    case ColumnType.Double:
+                        return view_.ReadDouble(position);
+                    case ColumnType.Single:
+                        return view_.ReadSingle(position);
+                    case ColumnType.Int32:
+                        return view_.ReadInt32(position);
+                    default:
+                        return view_.ReadInt64(position);
+                }
+            }
+
+            /// <summary>
+            /// Maps the window of the column that contains row i.
+            /// </summary>
+            private void Map(long i)
+            {
+                if (i < 0 || i >= rows_)
+                {
+                    throw new NPlotException("Row " + i + " is outside the columnar file, which has " + rows_ + " rows.");
+                }
+                if (owner_.file_ == null)
+                {
+                    throw new NPlotException("Columnar file has been disposed.");
+                }
+
+                Close();
+
+                long windowRows = windowBytes_/size_;
+                long first = i/windowRows*windowRows;
+                long count = Math.Min(windowRows, rows_ - first);
+                view_ = owner_.file_.CreateViewAccessor(Offset + first*size_, count*size_, MemoryMappedFileAccess.Read);
+                viewFirst_ = first;
+                viewCount_ = count;
+            }
+
+            internal void Close()
+            {
+                if (view_ != null)
+                {
+                    view_.Dispose();
+                    view_ = null;
+                }
+                viewFirst_ = 0;
+                viewCount_ = 0;
+            }
+        }
+
+        /// <summary>
+        /// A range of consecutive rows of a ColumnarFile, at most int.MaxValue long,
+        /// which can be used as the DataSource of sequence plots in the same way as
+        /// the file itself. Row 0 of the range is row First of the file.
+        /// </summary>
+        public class RowRange
+        {
+            internal RowRange(ColumnarFile file, long first, int count)
+            {
+                File = file;
+                First = first;
+                Count = count;
+            }
+
+            /// <summary>
+            /// The file the rows are in.
+            /// </summary>
+            public ColumnarFile File { get; private set; }
+
+            /// <summary>
+            /// The index in the file of the first row of the range.
+            /// </summary>
+            public long First { get; private set; }
+
+            /// <summary>
+            /// The number of rows in the range.
+            /// </summary>
+            public int Count { get; private set; }
+        }
+
+        private const string magic_ = "NPLOTCOL";
+        private const int version_ = 1;
+
+        private readonly ArrayList columns_ = new ArrayList();
+        private MemoryMappedFile file_;
+
+        /// <summary>
+        /// Opens a columnar file for reading. Only the header is read.
+        /// </summary>
+        /// <param name="path">The path of the file to open.</param>
+        public ColumnarFile(string path)
+        {
+            long rowCount;
+            string[] names;
+            ColumnType[] types;
+            bool[] sorted;
+            double[] mins;
+            double[] maxs;
+            long[] offsets;
+
+            using (FileStream fs = new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.Read))
+            {
+                BinaryReader r = new BinaryReader(fs, Encoding.UTF8);
+
+                if (Encoding.ASCII.GetString(r.ReadBytes(magic_.Length)) != magic_)
+                    throw new NPlotException("File is not an NPlot columnar file: " + path);
+
+                int version = r.ReadInt32();
+                if (version != version_)
+                    throw new NPlotException("Unsupported columnar file version: " + version);
+
+                rowCount = r.ReadInt64();
+                if (rowCount < 0)
+                    throw new NPlotException("Columnar file has a negative row count: " + rowCount);
+
+                int columnCount = r.ReadInt32();
+                names = new string[columnCount];
+                types = new ColumnType[columnCount];
+                sorted = new bool[columnCount];
+                mins = new double[columnCount];
+                maxs = new double[columnCount];
+                offsets = new long[columnCount];
+
+                for (int i = 0; i < columnCount; ++i)
+                {
+                    names[i] = r.ReadString();
+                    types[i] = (ColumnType) r.ReadByte();
+                    sorted[i] = r.ReadBoolean();
+                    mins[i] = r.ReadDouble();
+                    maxs[i] = r.ReadDouble();
+                    offsets[i] = r.ReadInt64();
+
+                    if (offsets[i] + rowCount*SizeOf(types[i]) > fs.Length)
+                        throw new NPlotException("Columnar file is truncated: " + path);
+                }
+            }
+
+            Count = rowCount;
+            Path = path;
+
+            if (rowCount > 0)
+            {
+                file_ = MemoryMappedFile.CreateFromFile(path, FileMode.Open, null, 0, MemoryMappedFileAccess.Read);
+            }
+
+            // columns are mapped a window at a time, as they are read.
+            for (int i = 0; i < names.Length; ++i)
+            {
+                columns_.Add(new Column(this, names[i], types[i], sorted[i], mins[i], maxs[i], offsets[i], rowCount));
+            }
+        }
+
+        /// <summary>
+        /// The path of the file.
+        /// </summary>
+        public string Path { get; private set; }
+
+        /// <summary>
+        /// The number of rows in the file.
+        /// </summary>
+        public long Count { get; private set; }
+
+        /// <summary>
+        /// Gets a range of rows of the file, to be plotted on its own. Plots of the file
+        /// itself use all rows, so this is needed when there are more than int.MaxValue.
+        /// </summary>
+        /// <param name="first">the index of the first row of the range.</param>
+        /// <param name="count">the number of rows in the range.</param>
+        /// <returns>the range.</returns>
+        public RowRange Rows(long first, int count)
+        {
+            if (first < 0 || count < 0 || first + count > Count)
+            {
+                throw new NPlotException("Row range is outside the columnar file.");
+            }
+            return new RowRange(this, first, count);
+        }
+
+        /// <summary>
+        /// The columns in the file, in the order they are stored.
+        /// </summary>
+        public ArrayList Columns
+        {
+            get { return ArrayList.ReadOnly(columns_); }
+        }
+
+        /// <summary>
+        /// Gets the column with the given name.
+        /// </summary>
+        /// <param name="name">the name of the column.</param>
+        /// <returns>the column.</returns>
+        public Column this[string name]
+        {
+            get
+            {
+                for (int i = 0; i < columns_.Count; ++i)
+                {
+                    if (((Column) columns_[i]).Name == name)
+                        return (Column) columns_[i];
+                }
+                throw new NPlotException("Columnar file does not contain column: " + name);
+            }
+        }
+
+        /// <summary>
+        /// Releases the memory mapping. Columns can not be read after this.
+        /// </summary>
+        public void Dispose()
+        {
+            for (int i = 0; i < columns_.Count; ++i)
+            {
+                ((Column) columns_[i]).Close();
+            }
+
+            if (file_ != null)
+            {
+                file_.Dispose();
+                file_ = null;
+            }
+        }
+
+        /// <summary>
+        /// Writes a columnar file. The extents of each column and whether it is
+        /// sorted are determined and recorded in the header.
+        /// </summary>
+        /// <param name="path">The path of the file to write.</param>
+        /// <param name="names">The column names.</param>
+        /// <param name="columns">The column data. Each entry must be an array of
+        /// double, float, long, int or DateTime, and all must have the same length.</param>
+        public static void Write(string path, string[] names, Array[] columns)
+        {
+            if (names.Length != columns.Length)
+                throw new NPlotException("The number of column names and columns must be equal.");
+
+            int rowCount = columns.Length > 0 ? columns[0].Length : 0;
+
+            ColumnType[] types = new ColumnType[columns.Length];
+            for (int i = 0; i < columns.Length; ++i)
+            {
+                if (columns[i].Length != rowCount)
+                    throw new NPlotException("All columns must have the same length.");
+                types[i] = TypeOf(columns[i]);
+            }
+
+            using (FileStream fs = new FileStream(path, FileMode.Create, FileAccess.Write))
+            {
+                BinaryWriter w = new BinaryWriter(fs, Encoding.UTF8);
+
+                // header size depends on the encoded names, so measure it first.
+                long headerLength = magic_.Length + 4 + 8 + 4;
+                for (int i = 0; i < names.Length; ++i)
+                {
+                    int nameLength = Encoding.UTF8.GetByteCount(names[i]);
+                    headerLength += SevenBitLength(nameLength) + nameLength + 1 + 1 + 8 + 8 + 8;
+                }
+
+                w.Write(Encoding.ASCII.GetBytes(magic_));
+                w.Write(version_);
+                w.Write((long) rowCount);
+                w.Write(columns.Length);
+
+                long offset = Align(headerLength);
+                for (int i = 0; i < columns.Length; ++i)
+                {
+                    double min = double.MaxValue;
+                    double max = double.MinValue;
+                    bool sorted = true;
+                    double previous = double.MinValue;
+
+                    for (int j = 0; j < rowCount; ++j)
+                    {
+                        double v = ValueAt(columns[i], j);
+                        if (v < min) min = v;
+                        if (v > max) max = v;
+                        if (!(v >= previous)) sorted = false;
+                        previous = v;
+                    }
+
+                    if (rowCount == 0)
+                    {
+                        min = 0.0;
+                        max = 0.0;
+                    }
+
+                    w.Write(names[i]);
+                    w.Write((byte) types[i]);
+                    w.Write(sorted);
+                    w.Write(min);
+                    w.Write(max);
+                    w.Write(offset);
+
+                    offset = Align(offset + (long) rowCount*SizeOf(types[i]));
+                }
+
+                for (int i = 0; i < columns.Length; ++i)
+                {
+                    w.Write(new byte[Align(fs.Position) - fs.Position]);
+                    WriteValues(w, columns[i], types[i]);
+                }
+
+                w.Flush();
+            }
+        }
+
+        private static void WriteValues(BinaryWriter w, Array column, ColumnType type)
+        {
+            switch (type)
+            {
+                case ColumnType.Double:
+                    foreach (double v in (double[]) column) w.Write(v);
+                    break;
+                case ColumnType.Single:
+                    foreach (float v in (float[]) column) w.Write(v);
+                    break;
+                case ColumnType.Int64:
+                    foreach (long v in (long[]) column) w.Write(v);
+                    break;
+                case ColumnType.Int32:
+                    foreach (int v in (int[]) column) w.Write(v);
+                    break;
+                case ColumnType.DateTime:
+                    foreach (DateTime v in (DateTime[]) column) w.Write(v.Ticks);
+                    break;
+            }
+        }
+
+        private static double ValueAt(Array column, int i)
+        {
+            if (column is double[])
+                return ((double[]) column)[i];
+            return Utils.ToDouble(column.GetValue(i));
+        }
+
+        private static ColumnType TypeOf(Array column)
+        {
+            if (column is double[]) return ColumnType.Double;
+            if (column is float[]) return ColumnType.Single;
+            if (column is long[]) return ColumnType.Int64;
+            if (column is int[]) return ColumnType.Int32;
+            if (column is DateTime[]) return ColumnType.DateTime;
+            throw new NPlotException("Columns must be arrays of double, float, long, int or DateTime.");
+        }
+
+        private static int SizeOf(ColumnType type)
+        {
+            if (type == ColumnType.Single || type == ColumnType.Int32)
+                return 4;
+            return 8;
+        }
+
+        private static int SevenBitLength(int value)
+        {
+            int length = 1;
+            while (value >= 0x80)
+            {
+                value >>= 7;
+                ++length;
+            }
+            return length;
+        }
+
+        private static long Align(long offset)
+        {
+            return (offset + 7) & ~7L;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,270 @@
+/*
+ * NPlot - A charting library for .NET
+ * 
+ * DataColumnCache.cs
+ * Copyright (C) 2003-2006 Matt Howlett and others.
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+using System;
+using System.Collections;
+using System.ComponentModel;
+using System.Data;
+using System.Runtime.CompilerServices;
+
+namespace NPlot
+{
+    /// <summary>
+    /// Caches the values of DataTable and DataView columns as arrays of doubles,
+    /// so that plots bound to these data sources don't look up, unbox and convert
+    /// every value on every draw. A column is extracted the first time it is
+    /// requested, and all columns of a source are discarded when the source
+    /// reports that its data has changed.
+    /// </summary>
+    /// <remarks>
+    /// DataTables raise events for all changes made through DataRow and the
+    /// collections, and DataViews raise ListChanged, so explicit invalidation
+    /// is not normally needed. Invalidate is provided for the rare cases in which
+    /// data is changed without raising events (e.g. after Merge with events
+    /// suspended via BeginLoadData).
+    /// </remarks>
+    public class DataColumnCache
+    {
+        /// <summary>
+        /// The cached values of a single column.
+        /// </summary>
+        public class Column
+        {
+            internal Column(double[] data, bool isDateTime)
+            {
+                Data = data;
+                IsDateTime = isDateTime;
+
+                double min = double.NaN;
+                double max = double.NaN;
+                for (int i = 0; i < data.Length; ++i)
+                {
+                    double e = data[i];
+                    if (double.IsNaN(e))
+                        continue;
+                    if (double.IsNaN(min) || e < min)
+                        min = e;
+                    if (double.IsNaN(max) || e > max)
+                        max = e;
+                }
+
+                HasExtents = !double.IsNaN(min);
+                Min = HasExtents ? min : 0.0;
+                Max = HasExtents ? max : 0.0;
+            }
+
+            /// <summary>
+            /// The column values, converted using Utils.ToDouble. This array must
+            /// not be modified.
+            /// </summary>
+            public double[] Data { get; private set; }
+
+            /// <summary>
+            /// True if the column holds DateTime values (expressed in Data as ticks).
+            /// </summary>
+            public bool IsDateTime { get; private set; }
+
+            /// <summary>
+            /// False if the column contains no values other than NaN, in which case
+            /// Min and Max are 0.
+            /// </summary>
+            public bool HasExtents { get; private set; }
+
+            /// <summary>
+            /// The minimum of the column values, ignoring NaN.
+            /// </summary>
+            public double Min { get; private set; }
+
+            /// <summary>
+            /// The maximum of the column values, ignoring NaN.
+            /// </summary>
+            public double Max { get; private set; }
+        }
+
+        // keyed on the DataTable or DataView without keeping it alive.
+        private static readonly ConditionalWeakTable<object, DataColumnCache> caches_ =
+            new ConditionalWeakTable<object, DataColumnCache>();
+
+        private Hashtable columns_ = new Hashtable();
+
+        private DataColumnCache(DataTable table)
+        {
+            table.RowChanged += OnRowChanged;
+            table.RowDeleted += OnRowChanged;
+            table.ColumnChanged += OnColumnChanged;
+            table.TableCleared += OnTableCleared;
+            table.Columns.CollectionChanged += OnCollectionChanged;
+        }
+
+        private DataColumnCache(DataView view)
+        {
+            view.ListChanged += OnListChanged;
+        }
+
+        /// <summary>
+        /// Gets the cached values of a column of a DataTable, extracting them if necessary.
+        /// </summary>
+        /// <param name="table">The DataTable containing the column.</param>
+        /// <param name="columnName">The name of the column.</param>
+        /// <returns>The cached column.</returns>
+        public static Column Get(DataTable table, string columnName)
+        {
+            DataColumnCache cache = caches_.GetValue(table, CreateForTable);
+
+            lock (cache)
+            {
+                Column c = (Column) cache.columns_[columnName];
+                if (c == null)
+                {
+                    c = Extract(table, columnName);
+                    cache.columns_[columnName] = c;
+                }
+                return c;
+            }
+        }
+
+        /// <summary>
+        /// Gets the cached values of a column of a DataView, extracting them if necessary.
+        /// The values are in view order, and only include rows visible in the view.
+        /// </summary>
+        /// <param name="view">The DataView containing the column.</param>
+        /// <param name="columnName">The name of the column.</param>
+        /// <returns>The cached column.</returns>
+        public static Column Get(DataView view, string columnName)
+        {
+            DataColumnCache cache = caches_.GetValue(view, CreateForView);
+
+            lock (cache)
+            {
+                Column c = (Column) cache.columns_[columnName];
+                if (c == null)
+                {
+                    c = Extract(view, columnName);
+                    cache.columns_[columnName] = c;
+                }
+                return c;
+            }
+        }
+
+        /// <summary>
+        /// Discards any cached columns of a DataTable or DataView.
+        /// </summary>
+        /// <param name="source">The DataTable or DataView.</param>
+        public static void Invalidate(object source)
+        {
+            DataColumnCache cache;
+            if (caches_.TryGetValue(source, out cache))
+            {
+                cache.Clear();
+            }
+        }
+
+        private static DataColumnCache CreateForTable(object table)
+        {
+            return new DataColumnCache((DataTable) table);
+        }
+
+        private static DataColumnCache CreateForView(object view)
+        {
+            return new DataColumnCache((DataView) view);
+        }
+
+        private static Column Extract(DataTable table, string columnName)
+        {
+            DataColumn column = ColumnNamed(table, columnName);
+            DataRowCollection rows = table.Rows;
+
+            double[] data = new double[rows.Count];
+            for (int i = 0; i < data.Length; ++i)
+            {
+                data[i] = Utils.ToDouble(rows[i][column]);
+            }
+
+            return new Column(data, rows.Count > 0 && rows[0][column] is DateTime);
+        }
+
+        private static Column Extract(DataView view, string columnName)
+        {
+            int ordinal = ColumnNamed(view.Table, columnName).Ordinal;
+
+            double[] data = new double[view.Count];
+            for (int i = 0; i < data.Length; ++i)
+            {
+                data[i] = Utils.ToDouble(view[i][ordinal]);
+            }
+
+            return new Column(data, view.Count > 0 && view[0][ordinal] is DateTime);
+        }
+
+        private static DataColumn ColumnNamed(DataTable table, string columnName)
+        {
+            DataColumn column = columnName == null ? null : table.Columns[columnName];
+            if (column == null)
+            {
+                throw new NPlotException("Data source does not contain column: " + columnName);
+            }
+            return column;
+        }
+
+        private void Clear()
+        {
+            lock (this)
+            {
+                if (columns_.Count > 0)
+                {
+                    columns_ = new Hashtable();
+                }
+            }
+        }
+
+        private void OnRowChanged(object sender, DataRowChangeEventArgs e)
+        {
+            Clear();
+        }
+
+        private void OnColumnChanged(object sender, DataColumnChangeEventArgs e)
+        {
+            Clear();
+        }
+
+        private void OnTableCleared(object sender, DataTableClearEventArgs e)
+        {
+            Clear();
+        }
+
+        private void OnCollectionChanged(object sender, CollectionChangeEventArgs e)
+        {
+            Clear();
+        }
+
+        private void OnListChanged(object sender, ListChangedEventArgs e)
+        {
+            Clear();
+        }
+    }
+}
\ No newline at end of file
@@ -26,6 +26,7 @@
  * OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+using System;
 using System.Drawing;
 
 namespace NPlot
@@ -145,15 +146,28 @@ namespace NPlot
                 SequenceAdapter a1 = new SequenceAdapter(lp1_.DataSource, lp1_.DataMember, lp1_.OrdinateData, lp1_.AbscissaData);
                 SequenceAdapter a2 = new SequenceAdapter(lp2_.DataSource, lp2_.DataMember, lp2_.OrdinateData, lp2_.AbscissaData);
 
-                int count = a1.Count + a2.Count;
-                PointF[] points = new PointF[count];
+                // points with missing (NaN) or infinite values are left out, for
+                // example the start of a rolling window that is not yet full.
+                PointF[] points = new PointF[a1.Count + a2.Count];
+                int count = 0;
                 for (int i = 0; i < a1.Count; ++i)
                 {
-                    points[i] = t.Transform(a1[i]);
+                    AddFinite(points, ref count, t, a1[i]);
                 }
-                for (int i = 0; i < a2.Count; ++i)
+                for (int i = a2.Count - 1; i >= 0; --i)
                 {
-                    points[i + a1.Count] = t.Transform(a2[a2.Count - i - 1]);
+                    AddFinite(points, ref count, t, a2[i]);
+                }
+
+                if (count < 3)
+                {
+                    return;
+                }
+                if (count < points.Length)
+                {
+                    PointF[] trimmed = new PointF[count];
+                    Array.Copy(points, trimmed, count);
+                    points = trimmed;
                 }
 
                 g.FillPolygon(b, points);
@@ -163,5 +177,23 @@ namespace NPlot
                 throw new NPlotException("One of bounds was set to null");
             }
         }
+
+        /// <summary>
+        /// Transforms a world point and adds it to points, if both it and the
+        /// result are finite.
+        /// </summary>
+        private static void AddFinite(PointF[] points, ref int count, ITransform2D t, PointD p)
+        {
+            if (Double.IsNaN(p.X) || Double.IsNaN(p.Y) || Double.IsInfinity(p.X) || Double.IsInfinity(p.Y))
+            {
+                return;
+            }
+            PointF q = t.Transform(p);
+            if (Single.IsNaN(q.X) || Single.IsNaN(q.Y) || Single.IsInfinity(q.X) || Single.IsInfinity(q.Y))
+            {
+                return;
+            }
+            points[count++] = q;
+        }
     }
 }
\ No newline at end of file
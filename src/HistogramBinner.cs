@@ -0,0 +1,601 @@
+/*
+ * NPlot - A charting library for .NET
+ * 
+ * HistogramBinner.cs
+ * Copyright (C) 2003-2006 Matt Howlett and others.
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+using System;
+using System.IO;
+using System.IO.MemoryMappedFiles;
+using System.Threading;
+
+namespace NPlot
+{
+    /// <summary>
+    /// Bins raw samples for display by a HistogramPlot. Samples are counted into a
+    /// fine grained base histogram over a fixed range, and the bars displayed are
+    /// worked out from that, so changing the displayed range or number of bars does
+    /// not require another pass over the samples. An instance can be used as the
+    /// DataSource of a HistogramPlot, with OrdinateData and AbscissaData left null.
+    /// </summary>
+    /// <remarks>
+    /// Large blocks of samples are binned in parallel, with each thread counting
+    /// into its own partial histogram which is then merged into the base histogram.
+    /// Samples may be added at any time, including from a thread other than the one
+    /// drawing the plot - the next draw shows them.
+    ///
+    /// The displayed bars can be no finer than the base bins. When a bar boundary
+    /// falls inside a base bin, the count of that bin is shared between the bars
+    /// in proportion to its overlap with each. Samples outside the base range are
+    /// counted in Underflow and Overflow, and NaN samples are ignored.
+    ///
+    /// If the plot is stacked, call StackGroup.Invalidate after adding samples or
+    /// changing the view.
+    /// </remarks>
+    public class HistogramBinner
+    {
+        /// <summary>
+        /// The smallest number of samples that is worth giving to a thread.
+        /// </summary>
+        private const int minSamplesPerThread_ = 1 << 16;
+
+        /// <summary>
+        /// The number of samples read from a stream or file at a time.
+        /// </summary>
+        private const int blockSize_ = 1 << 16;
+
+        /// <summary>
+        /// The relative tolerance within which bin boundaries are taken to coincide.
+        /// </summary>
+        private const double snap_ = 1e-9;
+
+        private readonly long[] base_;
+        private readonly double scale_;
+        private readonly object lock_ = new object();
+
+        private long underflow_;
+        private long overflow_;
+
+        private double viewMin_;
+        private double viewMax_;
+        private int viewBins_;
+
+        private double[] counts_;
+
+        /// <summary>
+        /// Counts the samples in one part of a block.
+        /// </summary>
+        private class Partial
+        {
+            private readonly HistogramBinner owner_;
+
+            public readonly long[] Counts;
+            public long Underflow;
+            public long Overflow;
+
+            public double[] Samples;
+            public int Start;
+            public int Count;
+
+            public MemoryMappedFile File;
+            public long Offset;
+            public long Length;
+
+            // set if binning failed, to be rethrown on the calling thread.
+            public Exception Error;
+
+            public Partial(HistogramBinner owner)
+            {
+                owner_ = owner;
+                Counts = new long[owner.base_.Length];
+            }
+
+            public void Bin(double[] samples, int start, int count)
+            {
+                owner_.Bin(samples, start, count, Counts, ref Underflow, ref Overflow);
+            }
+
+            public void BinSamples()
+            {
+                try
+                {
+                    Bin(Samples, Start, Count);
+                }
+                catch (Exception e)
+                {
+                    Error = e;
+                }
+            }
+
+            public void BinFile()
+            {
+                try
+                {
+                    double[] block = new double[blockSize_];
+                    using (MemoryMappedViewAccessor view =
+                        File.CreateViewAccessor(Offset, Length*8, MemoryMappedFileAccess.Read))
+                    {
+                        for (long done = 0; done < Length; done += blockSize_)
+                        {
+                            int n = (int) Math.Min(blockSize_, Length - done);
+                            view.ReadArray(done*8, block, 0, n);
+                            Bin(block, 0, n);
+                        }
+                    }
+                }
+                catch (Exception e)
+                {
+                    Error = e;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Constructor.
+        /// </summary>
+        /// <param name="min">the lower end of the base range.</param>
+        /// <param name="max">the upper end of the base range. Samples equal to max are counted in the last bin.</param>
+        /// <param name="baseBins">the number of base bins. This limits the resolution of the displayed bars.</param>
+        /// <param name="bins">the number of bars initially displayed across the base range.</param>
+        public HistogramBinner(double min, double max, int baseBins, int bins)
+        {
+            if (!(max > min) || double.IsInfinity(min) || double.IsInfinity(max))
+            {
+                throw new NPlotException("HistogramBinner range must be finite with max greater than min.");
+            }
+            if (baseBins < 1 || bins < 1)
+            {
+                throw new NPlotException("HistogramBinner must have at least one bin.");
+            }
+
+            Min = min;
+            Max = max;
+            base_ = new long[baseBins];
+            scale_ = baseBins/(max - min);
+            Threads = Environment.ProcessorCount;
+
+            viewMin_ = min;
+            viewMax_ = max;
+            viewBins_ = bins;
+        }
+
+        /// <summary>
+        /// The lower end of the base range.
+        /// </summary>
+        public double Min { get; private set; }
+
+        /// <summary>
+        /// The upper end of the base range.
+        /// </summary>
+        public double Max { get; private set; }
+
+        /// <summary>
+        /// The number of base bins.
+        /// </summary>
+        public int BaseBins
+        {
+            get { return base_.Length; }
+        }
+
+        /// <summary>
+        /// The greatest number of threads used to bin a block of samples. Defaults
+        /// to the number of processors. Small blocks are binned on the calling thread.
+        /// </summary>
+        public int Threads { get; set; }
+
+        /// <summary>
+        /// The number of samples added that were less than Min.
+        /// </summary>
+        public long Underflow
+        {
+            get { lock (lock_) return underflow_; }
+        }
+
+        /// <summary>
+        /// The number of samples added that were greater than Max.
+        /// </summary>
+        public long Overflow
+        {
+            get { lock (lock_) return overflow_; }
+        }
+
+        /// <summary>
+        /// The lower end of the displayed range.
+        /// </summary>
+        public double ViewMin
+        {
+            get { lock (lock_) return viewMin_; }
+        }
+
+        /// <summary>
+        /// The upper end of the displayed range.
+        /// </summary>
+        public double ViewMax
+        {
+            get { lock (lock_) return viewMax_; }
+        }
+
+        /// <summary>
+        /// The number of bars displayed.
+        /// </summary>
+        public int ViewBins
+        {
+            get { lock (lock_) return viewBins_; }
+        }
+
+        /// <summary>
+        /// Sets the range and number of bars displayed, typically in response to the
+        /// x axis being zoomed. The bars are re-binned from the base histogram.
+        /// </summary>
+        /// <param name="min">the lower end of the displayed range.</param>
+        /// <param name="max">the upper end of the displayed range.</param>
+        /// <param name="bins">the number of bars to display.</param>
+        public void SetView(double min, double max, int bins)
+        {
+            if (!(max > min) || double.IsInfinity(min) || double.IsInfinity(max))
+            {
+                throw new NPlotException("HistogramBinner view must be finite with max greater than min.");
+            }
+            if (bins < 1)
+            {
+                throw new NPlotException("HistogramBinner must have at least one bin.");
+            }
+
+            lock (lock_)
+            {
+                viewMin_ = min;
+                viewMax_ = max;
+                viewBins_ = bins;
+                counts_ = null;
+            }
+        }
+
+        /// <summary>
+        /// The heights of the displayed bars. A new array is returned whenever
+        /// samples are added or the view is changed.
+        /// </summary>
+        public double[] Counts
+        {
+            get
+            {
+                StartStep centers;
+                double[] counts;
+                GetView(out centers, out counts);
+                return counts;
+            }
+        }
+
+        /// <summary>
+        /// Gets the centers and heights of the displayed bars as one consistent pair.
+        /// </summary>
+        /// <param name="centers">the centers of the bars.</param>
+        /// <param name="counts">the heights of the bars. Not to be modified.</param>
+        internal void GetView(out StartStep centers, out double[] counts)
+        {
+            lock (lock_)
+            {
+                double width = (viewMax_ - viewMin_)/viewBins_;
+                centers = new StartStep(viewMin_ + width/2.0, width);
+
+                if (counts_ == null)
+                {
+                    counts_ = Rebin();
+                }
+                counts = counts_;
+            }
+        }
+
+        /// <summary>
+        /// Works out the displayed bars from the base histogram. Called with lock_ held.
+        /// </summary>
+        private double[] Rebin()
+        {
+            double[] bars = new double[viewBins_];
+
+            double baseWidth = (Max - Min)/base_.Length;
+            double barScale = viewBins_/(viewMax_ - viewMin_);
+
+            int first = (int) Math.Min(Math.Max(Math.Floor((viewMin_ - Min)/baseWidth), 0.0), base_.Length);
+            int last = (int) Math.Max(Math.Min(Math.Ceiling((viewMax_ - Min)/baseWidth), base_.Length), 0.0) - 1;
+
+            for (int j = first; j <= last; ++j)
+            {
+                long n = base_[j];
+                if (n == 0)
+                {
+                    continue;
+                }
+
+                // the base bin in bar coordinates, clipped to the view. Ends that are
+                // within rounding error of a bar boundary are moved onto it, so that
+                // when the boundaries line up the counts are carried over exactly.
+                double a = Math.Max(Snap((Min + j*baseWidth - viewMin_)*barScale), 0.0);
+                double b = Math.Min(Snap((Min + (j + 1)*baseWidth - viewMin_)*barScale), viewBins_);
+                if (b <= a)
+                {
+                    continue;
+                }
+
+                int k = (int) a;
+                if (b <= k + 1 && b - a >= baseWidth*barScale*(1.0 - snap_))
+                {
+                    bars[k] += n;
+                    continue;
+                }
+
+                double density = n/(baseWidth*barScale);
+                for (; k < viewBins_ && k < b; ++k)
+                {
+                    bars[k] += density*(Math.Min(b, k + 1) - Math.Max(a, k));
+                }
+            }
+
+            return bars;
+        }
+
+        /// <summary>
+        /// Rounds a position in bar coordinates to the nearest boundary if it is within
+        /// rounding error of it.
+        /// </summary>
+        private static double Snap(double x)
+        {
+            double r = Math.Round(x);
+            return Math.Abs(x - r) < snap_*Math.Max(1.0, Math.Abs(x)) ? r : x;
+        }
+
+        /// <summary>
+        /// Discards all samples added so far.
+        /// </summary>
+        public void Clear()
+        {
+            lock (lock_)
+            {
+                Array.Clear(base_, 0, base_.Length);
+                underflow_ = 0;
+                overflow_ = 0;
+                counts_ = null;
+            }
+        }
+
+        /// <summary>
+        /// Adds a single sample. Prefer adding samples in blocks.
+        /// </summary>
+        /// <param name="sample">the sample to add.</param>
+        public void Add(double sample)
+        {
+            Add(new double[] {sample}, 0, 1);
+        }
+
+        /// <summary>
+        /// Adds an array of samples.
+        /// </summary>
+        /// <param name="samples">the samples to add.</param>
+        public void Add(double[] samples)
+        {
+            Add(samples, 0, samples.Length);
+        }
+
+        /// <summary>
+        /// Adds part of an array of samples.
+        /// </summary>
+        /// <param name="samples">the array holding the samples.</param>
+        /// <param name="start">the index of the first sample to add.</param>
+        /// <param name="count">the number of samples to add.</param>
+        public void Add(double[] samples, int start, int count)
+        {
+            if (start < 0 || count < 0 || start + count > samples.Length)
+            {
+                throw new NPlotException("Sample range is outside the array.");
+            }
+
+            int threads = ThreadsFor(count);
+            if (threads == 1)
+            {
+                lock (lock_)
+                {
+                    Bin(samples, start, count, base_, ref underflow_, ref overflow_);
+                    counts_ = null;
+                }
+                return;
+            }
+
+            Partial[] parts = new Partial[threads];
+            for (int i = 0; i < threads; ++i)
+            {
+                parts[i] = new Partial(this);
+                parts[i].Samples = samples;
+                parts[i].Start = start + (int) ((long) count*i/threads);
+                parts[i].Count = start + (int) ((long) count*(i + 1)/threads) - parts[i].Start;
+            }
+            Run(parts, false);
+        }
+
+        /// <summary>
+        /// Adds samples read from a stream of little endian doubles, until the end of
+        /// the stream. The stream is not closed.
+        /// </summary>
+        /// <param name="stream">the stream to read samples from.</param>
+        public void Add(Stream stream)
+        {
+            byte[] bytes = new byte[blockSize_*8];
+            double[] block = new double[blockSize_];
+            int held = 0;
+
+            while (true)
+            {
+                int read = stream.Read(bytes, held, bytes.Length - held);
+                if (read <= 0)
+                {
+                    break;
+                }
+                held += read;
+
+                int n = held/8;
+                if (held == bytes.Length)
+                {
+                    Buffer.BlockCopy(bytes, 0, block, 0, n*8);
+                    Add(block, 0, n);
+                    held = 0;
+                }
+            }
+
+            if (held >= 8)
+            {
+                Buffer.BlockCopy(bytes, 0, block, 0, (held/8)*8);
+                Add(block, 0, held/8);
+            }
+        }
+
+        /// <summary>
+        /// Adds samples from a file of little endian doubles, which is read via a memory
+        /// mapping. The file is divided between threads, each of which maps its own
+        /// part, so it is binned in parallel without being loaded.
+        /// </summary>
+        /// <param name="path">the path of the file.</param>
+        public void AddFile(string path)
+        {
+            long length = new FileInfo(path).Length/8;
+            if (length == 0)
+            {
+                return;
+            }
+
+            using (MemoryMappedFile file =
+                MemoryMappedFile.CreateFromFile(path, FileMode.Open, null, 0, MemoryMappedFileAccess.Read))
+            {
+                int threads = ThreadsFor(length);
+                Partial[] parts = new Partial[threads];
+                for (int i = 0; i < threads; ++i)
+                {
+                    parts[i] = new Partial(this);
+                    parts[i].File = file;
+                    parts[i].Offset = length*i/threads*8;
+                    parts[i].Length = length*(i + 1)/threads - length*i/threads;
+                }
+                Run(parts, true);
+            }
+        }
+
+        /// <summary>
+        /// The number of threads to bin the given number of samples with.
+        /// </summary>
+        private int ThreadsFor(long count)
+        {
+            long threads = Math.Min(Math.Max(Threads, 1), count/minSamplesPerThread_);
+            return (int) Math.Max(threads, 1);
+        }
+
+        /// <summary>
+        /// Counts samples into the given bins.
+        /// </summary>
+        private void Bin(double[] samples, int start, int count, long[] counts,
+                         ref long underflow, ref long overflow)
+        {
+            double min = Min;
+            double max = Max;
+            double scale = scale_;
+            int last = counts.Length - 1;
+
+            for (int i = start; i < start + count; ++i)
+            {
+                double v = samples[i];
+                if (v >= min && v <= max)
+                {
+                    int b = (int) ((v - min)*scale);
+                    counts[b > last ? last : b]++;
+                }
+                else if (v < min)
+                {
+                    underflow++;
+                }
+                else if (v > max)
+                {
+                    overflow++;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Runs the partials, all but the first on their own threads, then merges them.
+        /// </summary>
+        private void Run(Partial[] parts, bool file)
+        {
+            Thread[] threads = new Thread[parts.Length];
+            for (int i = 1; i < parts.Length; ++i)
+            {
+                threads[i] = new Thread(file ? new ThreadStart(parts[i].BinFile) : parts[i].BinSamples);
+                threads[i].IsBackground = true;
+                threads[i].Start();
+            }
+
+            if (file)
+            {
+                parts[0].BinFile();
+            }
+            else
+            {
+                parts[0].BinSamples();
+            }
+
+            for (int i = 1; i < parts.Length; ++i)
+            {
+                threads[i].Join();
+            }
+
+            // nothing is added unless every partial succeeded.
+            for (int i = 0; i < parts.Length; ++i)
+            {
+                if (parts[i].Error != null)
+                {
+                    throw new NPlotException("Histogram binning failed: " + parts[i].Error.Message, parts[i].Error);
+                }
+            }
+
+            Merge(parts);
+        }
+
+        /// <summary>
+        /// Adds the counts of the partials to the base histogram, all under one lock
+        /// so that no view is made from half merged counts.
+        /// </summary>
+        private void Merge(Partial[] parts)
+        {
+            lock (lock_)
+            {
+                for (int p = 0; p < parts.Length; ++p)
+                {
+                    long[] counts = parts[p].Counts;
+                    for (int i = 0; i < counts.Length; ++i)
+                    {
+                        base_[i] += counts[i];
+                    }
+                    underflow_ += parts[p].Underflow;
+                    overflow_ += parts[p].Overflow;
+                }
+                counts_ = null;
+            }
+        }
+    }
+}
\ No newline at end of file
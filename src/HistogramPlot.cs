@@ -27,7 +27,6 @@
  */
 
 using System;
-using System.Collections;
 using System.Drawing;
 
 namespace NPlot
@@ -43,6 +42,7 @@ namespace NPlot
         private bool isStacked_;
         private Pen pen_ = new Pen(Color.Black);
         private IRectangleBrush rectangleBrush_ = new RectangleBrushes.Solid(Color.Black);
+        private StackGroup stackGroup_;
         private HistogramPlot stackedTo_;
 
         /// <summary>
@@ -98,6 +98,35 @@ namespace NPlot
             get { return isStacked_; }
         }
 
+        /// <summary>
+        /// The plot this one is stacked on, or null.
+        /// </summary>
+        internal HistogramPlot StackedToPlot
+        {
+            get { return stackedTo_; }
+        }
+
+        /// <summary>
+        /// The cumulative heights of the stack this plot is part of. All the plots of a
+        /// stack share the group of the plot at the bottom of it.
+        /// </summary>
+        public StackGroup StackGroup
+        {
+            get
+            {
+                HistogramPlot bottom = this;
+                while (bottom.stackedTo_ != null)
+                {
+                    bottom = bottom.stackedTo_;
+                }
+                if (bottom.stackGroup_ == null)
+                {
+                    bottom.stackGroup_ = new StackGroup();
+                }
+                return bottom.stackGroup_;
+            }
+        }
+
         /// <summary>
         /// The pen used to draw the plot
         /// </summary>
@@ -144,113 +173,133 @@ namespace NPlot
         public void Draw(Graphics g, PhysicalAxis xAxis, PhysicalAxis yAxis)
         {
             SequenceAdapter data =
-                new SequenceAdapter(DataSource, DataMember, OrdinateData, AbscissaData);
+                new SequenceAdapter(DataSource, DataMember, OrdinateData, AbscissaData, AbscissaSorted);
 
             float yoff;
 
-            for (int i = 0; i < data.Count; ++i)
+            // only consider bars near the visible range. Widen by one either
+            // side, as centering can shift a bar by half its width.
+            double leftCutoff = xAxis.PhysicalToWorld(xAxis.PhysicalMin, false) - baseOffset_;
+            double rightCutoff = xAxis.PhysicalToWorld(xAxis.PhysicalMax, false) - baseOffset_;
+            int first = 0;
+            int last = data.Count - 1;
+            if (!xAxis.ReferencePath)
             {
-                // (1) determine the top left hand point of the bar (assuming not centered)
-                PointD p1 = data[i];
-                if (double.IsNaN(p1.X) || double.IsNaN(p1.Y))
-                    continue;
-
-                // (2) determine the top right hand point of the bar (assuming not centered)
-                PointD p2;
-                if (i + 1 != data.Count)
-                {
-                    p2 = data[i + 1];
-                    if (double.IsNaN(p2.X) || double.IsNaN(p2.Y))
-                        continue;
-                    p2.Y = p1.Y;
-                }
-                else if (i != 0)
-                {
-                    p2 = data[i - 1];
-                    if (double.IsNaN(p2.X) || double.IsNaN(p2.Y))
-                        continue;
-                    double offset = p1.X - p2.X;
-                    p2.X = p1.X + offset;
-                    p2.Y = p1.Y;
-                }
-                else
+                data.GetIndexRange(Math.Min(leftCutoff, rightCutoff), Math.Max(leftCutoff, rightCutoff),
+                                   out first, out last);
+                first = Math.Max(first - 1, 0);
+                last = Math.Min(last + 1, data.Count - 1);
+            }
+
+            // heights of the bars and the bars below them, if stacked.
+            double[] tops = null;
+            double[] baselines = null;
+            if (isStacked_)
+            {
+                StackGroup group = StackGroup;
+                if (xAxis.ReferencePath)
                 {
-                    double offset = 1.0f;
-                    p2.X = p1.X + offset;
-                    p2.Y = p1.Y;
+                    group.Invalidate();
                 }
+                tops = group.Tops(this);
+                baselines = group.Baselines(this);
 
-                // (3) now account for plots this may be stacked on top of.
-                HistogramPlot currentPlot = this;
-                yoff = 0.0f;
-                double yval = 0.0f;
-                while (currentPlot.isStacked_)
+                HistogramPlot bottom = stackedTo_;
+                while (bottom.isStacked_)
                 {
-                    SequenceAdapter stackedToData = new SequenceAdapter(
-                        currentPlot.stackedTo_.DataSource,
-                        currentPlot.stackedTo_.DataMember,
-                        currentPlot.stackedTo_.OrdinateData,
-                        currentPlot.stackedTo_.AbscissaData);
-
-                    yval += stackedToData[i].Y;
-                    yoff = yAxis.WorldToPhysical(yval, false).Y;
-                    p1.Y += stackedToData[i].Y;
-                    p2.Y += stackedToData[i].Y;
-                    currentPlot = currentPlot.stackedTo_;
+                    bottom = bottom.stackedTo_;
                 }
+                baseWidth_ = bottom.baseWidth_;
+            }
 
-                // (4) now account for centering
-                if (center_)
+            // one brush fitted to each bar in turn, rather than a new brush per bar
+            // (except on the reference path).
+            using (RectangleBrushCache brushes = new RectangleBrushCache(rectangleBrush_))
+            {
+                IRectangleBrush fill = xAxis.ReferencePath ? rectangleBrush_ : brushes;
+                for (int i = first; i <= last; ++i)
                 {
-                    double offset = (p2.X - p1.X)/2.0f;
-                    p1.X -= offset;
-                    p2.X -= offset;
-                }
+                    // (1) determine the top left hand point of the bar (assuming not centered)
+                    PointD p1 = data[i];
+                    if (double.IsNaN(p1.X) || double.IsNaN(p1.Y))
+                        continue;
 
-                // (5) now account for BaseOffset (shift of bar sideways).
-                p1.X += baseOffset_;
-                p2.X += baseOffset_;
+                    // (2) determine the top right hand point of the bar (assuming not centered)
+                    PointD p2;
+                    if (i + 1 != data.Count)
+                    {
+                        p2 = data[i + 1];
+                        if (double.IsNaN(p2.X) || double.IsNaN(p2.Y))
+                            continue;
+                        p2.Y = p1.Y;
+                    }
+                    else if (i != 0)
+                    {
+                        p2 = data[i - 1];
+                        if (double.IsNaN(p2.X) || double.IsNaN(p2.Y))
+                            continue;
+                        double offset = p1.X - p2.X;
+                        p2.X = p1.X + offset;
+                        p2.Y = p1.Y;
+                    }
+                    else
+                    {
+                        double offset = 1.0f;
+                        p2.X = p1.X + offset;
+                        p2.Y = p1.Y;
+                    }
 
-                // (6) now get physical coordinates of top two points.
-                PointF xPos1 = xAxis.WorldToPhysical(p1.X, false);
-                PointF yPos1 = yAxis.WorldToPhysical(p1.Y, false);
-                PointF xPos2 = xAxis.WorldToPhysical(p2.X, false);
-                //PointF yPos2 = yAxis.WorldToPhysical(p2.Y, false);
+                    // (3) now account for plots this may be stacked on top of.
+                    yoff = 0.0f;
+                    if (isStacked_)
+                    {
+                        yoff = yAxis.WorldToPhysical(baselines[i], false).Y;
+                        p1.Y = tops[i];
+                        p2.Y = tops[i];
+                    }
 
-                if (isStacked_)
-                {
-                    currentPlot = this;
-                    while (currentPlot.isStacked_)
+                    // (4) now account for centering
+                    if (center_)
                     {
-                        currentPlot = currentPlot.stackedTo_;
+                        double offset = (p2.X - p1.X)/2.0f;
+                        p1.X -= offset;
+                        p2.X -= offset;
                     }
-                    baseWidth_ = currentPlot.baseWidth_;
-                }
 
-                float width = xPos2.X - xPos1.X;
-                float height;
-                if (isStacked_)
-                {
-                    height = -yPos1.Y + yoff;
-                }
-                else
-                {
-                    height = -yPos1.Y + yAxis.PhysicalMin.Y;
-                }
+                    // (5) now account for BaseOffset (shift of bar sideways).
+                    p1.X += baseOffset_;
+                    p2.X += baseOffset_;
 
-                float xoff = (1.0f - baseWidth_)/2.0f*width;
-                Rectangle r = new Rectangle((int) (xPos1.X + xoff), (int) yPos1.Y, (int) (width - 2*xoff), (int) height);
+                    // (6) now get physical coordinates of top two points.
+                    PointF xPos1 = xAxis.WorldToPhysical(p1.X, false);
+                    PointF yPos1 = yAxis.WorldToPhysical(p1.Y, false);
+                    PointF xPos2 = xAxis.WorldToPhysical(p2.X, false);
+                    //PointF yPos2 = yAxis.WorldToPhysical(p2.Y, false);
 
-                if (Filled)
-                {
-                    if (r.Height != 0 && r.Width != 0)
+                    float width = xPos2.X - xPos1.X;
+                    float height;
+                    if (isStacked_)
                     {
-                        // room for optimization maybe.
-                        g.FillRectangle(rectangleBrush_.Get(r), r);
+                        height = -yPos1.Y + yoff;
+                    }
+                    else
+                    {
+                        height = -yPos1.Y + yAxis.PhysicalMin.Y;
                     }
-                }
 
-                g.DrawRectangle(Pen, r.X, r.Y, r.Width, r.Height);
+                    float xoff = (1.0f - baseWidth_)/2.0f*width;
+                    Rectangle r = new Rectangle((int) (xPos1.X + xoff), (int) yPos1.Y, (int) (width - 2*xoff), (int) height);
+
+                    if (Filled)
+                    {
+                        if (r.Height != 0 && r.Width != 0)
+                        {
+                            g.FillRectangle(fill.Get(r), r);
+                        }
+                    }
+
+                    g.DrawRectangle(Pen, r.X, r.Y, r.Width, r.Height);
+                }
             }
         }
 
@@ -318,30 +367,10 @@ namespace NPlot
             if (isStacked_)
             {
                 double tmpMax = 0.0f;
-                ArrayList adapterList = new ArrayList();
-
-                HistogramPlot currentPlot = this;
-                do
+                double[] tops = StackGroup.Tops(this);
+                for (int i = 0; i < tops.Length; ++i)
                 {
-                    adapterList.Add(new SequenceAdapter(
-                                        currentPlot.DataSource,
-                                        currentPlot.DataMember,
-                                        currentPlot.OrdinateData,
-                                        currentPlot.AbscissaData)
-                        );
-                } while ((currentPlot = currentPlot.stackedTo_) != null);
-
-                SequenceAdapter[] adapters =
-                    (SequenceAdapter[]) adapterList.ToArray(typeof (SequenceAdapter));
-
-                for (int i = 0; i < adapters[0].Count; ++i)
-                {
-                    double tmpHeight = 0.0f;
-                    for (int j = 0; j < adapters.Length; ++j)
-                    {
-                        tmpHeight += adapters[j][i].Y;
-                    }
-                    tmpMax = Math.Max(tmpMax, tmpHeight);
+                    tmpMax = Math.Max(tmpMax, tops[i]);
                 }
 
                 Axis a = new LinearAxis(0.0f, tmpMax);
@@ -376,6 +405,10 @@ namespace NPlot
         /// <summary>
         /// Stack the histogram to another HistogramPlot.
         /// </summary>
+        /// <remarks>
+        /// The cumulative heights of the stack are kept by its StackGroup. Call
+        /// StackGroup.Invalidate if the data of any plot in the stack is changed in place.
+        /// </remarks>
         public void StackedTo(HistogramPlot hp)
         {
             SequenceAdapter data =
@@ -0,0 +1,48 @@
+/*
+ * NPlot - A charting library for .NET
+ * 
+ * IPreviewDrawable.cs
+ * Copyright (C) 2003-2006 Matt Howlett and others.
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+using System.Drawing;
+
+namespace NPlot
+{
+    /// <summary>
+    /// Defines a method for drawing a quick approximation of an object, used
+    /// in place of Draw when a plot surface is drawn with DrawQuality.Preview.
+    /// </summary>
+    public interface IPreviewDrawable : IDrawable
+    {
+        /// <summary>
+        /// Draws a quick approximation of this object against an x and y PhysicalAxis.
+        /// </summary>
+        /// <param name="g">The graphics surface on which to draw.</param>
+        /// <param name="xAxis">The physical x-axis to draw against.</param>
+        /// <param name="yAxis">The physical y-axis to draw against.</param>
+        /// <param name="decimation">The size in pixels of the detail that may be lost.</param>
+        void DrawPreview(Graphics g, PhysicalAxis xAxis, PhysicalAxis yAxis, int decimation);
+    }
+}
\ No newline at end of file
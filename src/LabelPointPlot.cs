@@ -64,8 +64,38 @@ namespace NPlot
             Right
         }
 
+        /// <summary>
+        /// What to do with a label that would overlap one already drawn.
+        /// </summary>
+        public enum LabelOverlaps
+        {
+            /// <summary>
+            /// Draw it anyway.
+            /// </summary>
+            Draw,
+
+            /// <summary>
+            /// Don't draw it.
+            /// </summary>
+            Hide,
+
+            /// <summary>
+            /// Try the other label positions in turn, and don't draw it if none is free.
+            /// </summary>
+            Shift
+        }
+
+        /// <summary>
+        /// The size in pixels of the squares the plot area is divided into to keep
+        /// track of where labels have been drawn.
+        /// </summary>
+        private const int cellSize_ = 4;
+
+        private readonly StringSizeCache sizes_ = new StringSizeCache();
+
         private Font font_ = new Font("Arial", 8.0f);
         private LabelPositions labelTextPosition_ = LabelPositions.Above;
+        private LabelOverlaps labelOverlap_ = LabelOverlaps.Hide;
 
         /// <summary>
         /// Default Constructor
@@ -92,6 +122,18 @@ namespace NPlot
             set { labelTextPosition_ = value; }
         }
 
+        /// <summary>
+        /// What to do with labels that would overlap labels already drawn. Labels are
+        /// drawn in the order of the data. The default is Hide, which keeps the cost
+        /// of drawing a large labelled plot close to that of drawing just the labels
+        /// that can be read.
+        /// </summary>
+        public LabelOverlaps LabelOverlap
+        {
+            get { return labelOverlap_; }
+            set { labelOverlap_ = value; }
+        }
+
         /// <summary>
         /// The text datasource to attach to each point.
         /// </summary>
@@ -107,51 +149,111 @@ namespace NPlot
         }
 
         /// <summary>
-        /// Draws the plot on a GDI+ surface against the provided x and y axes.
+        /// Draws the plot on a GDI+ surface against the provided x and y axes. Only
+        /// points inside the plot area are labelled.
         /// </summary>
         /// <param name="g">The GDI+ surface on which to draw.</param>
         /// <param name="xAxis">The X-Axis to draw against.</param>
         /// <param name="yAxis">The Y-Axis to draw against.</param>
         public override void Draw(Graphics g, PhysicalAxis xAxis, PhysicalAxis yAxis)
         {
+            // first plot the markers, then the labels over them.
+            base.Draw(g, xAxis, yAxis);
+
             SequenceAdapter data =
-                new SequenceAdapter(DataSource, DataMember, OrdinateData, AbscissaData);
+                new SequenceAdapter(DataSource, DataMember, OrdinateData, AbscissaData, AbscissaSorted);
 
             TextDataAdapter textData =
                 new TextDataAdapter(DataSource, DataMember, TextData);
 
-            // first plot the marker
-            // we can do this cast, since the constructor accepts only this type!
-            for (int i = 0; i < data.Count; ++i)
+            if (data.Count == 0)
+            {
+                return;
+            }
+
+            int left = Math.Min(xAxis.PhysicalMin.X, xAxis.PhysicalMax.X);
+            int right = Math.Max(xAxis.PhysicalMin.X, xAxis.PhysicalMax.X);
+            int top = Math.Min(yAxis.PhysicalMin.Y, yAxis.PhysicalMax.Y);
+            int bottom = Math.Max(yAxis.PhysicalMin.Y, yAxis.PhysicalMax.Y);
+
+            // only consider points in the visible range.
+            double worldLeft = xAxis.PhysicalToWorld(xAxis.PhysicalMin, false);
+            double worldRight = xAxis.PhysicalToWorld(xAxis.PhysicalMax, false);
+            if (worldLeft > worldRight)
+            {
+                Utils.Swap(ref worldLeft, ref worldRight);
+            }
+            int first = 0;
+            int last = data.Count - 1;
+            if (!xAxis.ReferencePath)
+            {
+                data.GetIndexRange(worldLeft, worldRight, out first, out last);
+            }
+
+            int n = last - first + 1;
+            double[] worldX = new double[n];
+            double[] worldY = new double[n];
+            data.CopyTo(first, n, worldX, worldY);
+
+            float[] physicalX = new float[n];
+            float[] physicalY = new float[n];
+            xAxis.WorldToPhysical(worldX, 0, n, physicalX, null);
+            yAxis.WorldToPhysical(worldY, 0, n, null, physicalY);
+
+            // squares of the plot area already covered by a label.
+            int columns = (right - left)/cellSize_ + 1;
+            int rows = (bottom - top)/cellSize_ + 1;
+            bool[] occupied = labelOverlap_ == LabelOverlaps.Draw ? null : new bool[columns*rows];
+
+            float offset = Marker.Size*2/3;
+
+            for (int i = 0; i < n; ++i)
             {
                 try
                 {
-                    PointD pt = data[i];
-                    if (!Double.IsNaN(pt.X) && !Double.IsNaN(pt.Y))
+                    float x = physicalX[i];
+                    float y = physicalY[i];
+                    if (Double.IsNaN(worldX[i]) || Double.IsNaN(worldY[i]) ||
+                        !(x >= left && x <= right && y >= top && y <= bottom))
                     {
-                        PointF xPos = xAxis.WorldToPhysical(pt.X, false);
-                        PointF yPos = yAxis.WorldToPhysical(pt.Y, false);
-                        Marker.Draw(g, (int) xPos.X, (int) yPos.Y);
-                        if (textData[i] != "")
+                        continue;
+                    }
+
+                    // a label always covers the square of its anchor point, so if that
+                    // is taken for every position to be tried the label can be skipped
+                    // without being measured.
+                    int tries = labelOverlap_ == LabelOverlaps.Shift ? 4 : 1;
+                    bool anyFree = occupied == null;
+                    for (int t = 0; !anyFree && t < tries; ++t)
+                    {
+                        anyFree = AnchorFree(occupied, columns, rows, left, top, Position(t), x, y, offset);
+                    }
+                    if (!anyFree)
+                    {
+                        continue;
+                    }
+
+                    string text = textData[first + i];
+                    if (text == null || text == "")
+                    {
+                        continue;
+                    }
+
+                    SizeF size = sizes_.Measure(g, text, font_);
+
+                    for (int t = 0; t < tries; ++t)
+                    {
+                        LabelPositions position = Position(t);
+                        if (occupied != null && !AnchorFree(occupied, columns, rows, left, top, position, x, y, offset))
                         {
-                            SizeF size = g.MeasureString(textData[i], Font);
-                            switch (labelTextPosition_)
-                            {
-                                case LabelPositions.Above:
-                                    g.DrawString(textData[i], font_, Brushes.Black,
-                                                 new PointF(xPos.X - size.Width/2, yPos.Y - size.Height - Marker.Size*2/3));
-                                    break;
-                                case LabelPositions.Below:
-                                    g.DrawString(textData[i], font_, Brushes.Black, new PointF(xPos.X - size.Width/2, yPos.Y + Marker.Size*2/3));
-                                    break;
-                                case LabelPositions.Left:
-                                    g.DrawString(textData[i], font_, Brushes.Black,
-                                                 new PointF(xPos.X - size.Width - Marker.Size*2/3, yPos.Y - size.Height/2));
-                                    break;
-                                case LabelPositions.Right:
-                                    g.DrawString(textData[i], font_, Brushes.Black, new PointF(xPos.X + Marker.Size*2/3, yPos.Y - size.Height/2));
-                                    break;
-                            }
+                            continue;
+                        }
+
+                        RectangleF r = LabelBounds(position, x, y, size, offset);
+                        if (occupied == null || Claim(occupied, columns, rows, left, top, r))
+                        {
+                            g.DrawString(text, font_, Brushes.Black, r.Location);
+                            break;
                         }
                     }
                 }
@@ -162,6 +264,100 @@ namespace NPlot
             }
         }
 
+        /// <summary>
+        /// The label position tried at the given attempt: LabelTextPosition first, then
+        /// the others in turn.
+        /// </summary>
+        private LabelPositions Position(int attempt)
+        {
+            return (LabelPositions) (((int) labelTextPosition_ + attempt)%4);
+        }
+
+        /// <summary>
+        /// Whether the square holding the anchor point of a label in the given position
+        /// is free. The anchor is the point of the label nearest its data point, and is
+        /// inside the label whatever the size of its text. Anchors outside the plot area
+        /// are not considered, as by Claim.
+        /// </summary>
+        private static bool AnchorFree(bool[] occupied, int columns, int rows, int left, int top,
+                                       LabelPositions position, float x, float y, float offset)
+        {
+            RectangleF anchor = LabelBounds(position, x, y, SizeF.Empty, offset);
+
+            int column = (int) Math.Floor((anchor.X - left)/cellSize_);
+            int row = (int) Math.Floor((anchor.Y - top)/cellSize_);
+            if (column < 0 || column >= columns || row < 0 || row >= rows)
+            {
+                return true;
+            }
+
+            return !occupied[row*columns + column];
+        }
+
+        /// <summary>
+        /// Works out where a label goes relative to its point.
+        /// </summary>
+        private static RectangleF LabelBounds(LabelPositions position, float x, float y, SizeF size, float offset)
+        {
+            switch (position)
+            {
+                case LabelPositions.Above:
+                    return new RectangleF(x - size.Width/2, y - size.Height - offset, size.Width, size.Height);
+                case LabelPositions.Below:
+                    return new RectangleF(x - size.Width/2, y + offset, size.Width, size.Height);
+                case LabelPositions.Left:
+                    return new RectangleF(x - size.Width - offset, y - size.Height/2, size.Width, size.Height);
+                default:
+                    return new RectangleF(x + offset, y - size.Height/2, size.Width, size.Height);
+            }
+        }
+
+        /// <summary>
+        /// Marks the squares covered by a label as occupied, unless any of them already
+        /// is, in which case nothing is marked and false is returned. The parts of the
+        /// label outside the plot area are not considered.
+        /// </summary>
+        private static bool Claim(bool[] occupied, int columns, int rows, int left, int top, RectangleF r)
+        {
+            int c1 = Math.Max((int) Math.Floor((r.Left - left)/cellSize_), 0);
+            int c2 = Math.Min((int) Math.Floor((r.Right - left)/cellSize_), columns - 1);
+            int r1 = Math.Max((int) Math.Floor((r.Top - top)/cellSize_), 0);
+            int r2 = Math.Min((int) Math.Floor((r.Bottom - top)/cellSize_), rows - 1);
+
+            for (int row = r1; row <= r2; ++row)
+            {
+                for (int column = c1; column <= c2; ++column)
+                {
+                    if (occupied[row*columns + column])
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            for (int row = r1; row <= r2; ++row)
+            {
+                for (int column = c1; column <= c2; ++column)
+                {
+                    occupied[row*columns + column] = true;
+                }
+            }
+
+            return true;
+        }
+
+        /// <summary>
+        /// Labels are not decimated, so the preview is the full plot.
+        /// </summary>
+        /// <param name="g">The GDI+ surface on which to draw.</param>
+        /// <param name="xAxis">The X-Axis to draw against.</param>
+        /// <param name="yAxis">The Y-Axis to draw against.</param>
+        /// <param name="decimation">Not used.</param>
+        public override void DrawPreview(Graphics g, PhysicalAxis xAxis, PhysicalAxis yAxis, int decimation)
+        {
+            Draw(g, xAxis, yAxis);
+        }
+
         /// <summary>
         /// This class us used in conjunction with SequenceAdapter to interpret data
         /// specified to the TextPlot class.
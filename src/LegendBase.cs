@@ -61,9 +61,46 @@ namespace NPlot
             //Curved = 3
         }
 
+        /// <summary>
+        /// The sizes and positions of the parts of a legend, which depend only on the
+        /// entries, font, scale, arrangement and border - so they are worked out once
+        /// and kept until one of these changes.
+        /// </summary>
+        private class Layout
+        {
+            // what the layout was worked out for.
+            public IPlot[] Plots;
+            public string[] Labels;
+            public Font Font;
+            public bool AutoScaleText;
+            public float Scale;
+            public int ItemsHorizontally;
+            public int ItemsVertically;
+            public BorderType BorderStyle;
+            public float DpiX;
+            public float DpiY;
+            public GraphicsUnit PageUnit;
+
+            // the layout.
+            public Font TextFont;
+            public string[] Text;
+            public int MaxWidth;
+            public int MaxHeight;
+            public int HSpacing;
+            public int VSpacing;
+            public int ShadowOffset;
+            public int BoxWidth;
+            public int BoxHeight;
+            public int TotalWidth;
+            public int TotalHeight;
+        }
+
+        private const int lineLength_ = 20;
+
         private Color bgColor_;
         private Color borderColor_;
         private Font font_;
+        private Layout layout_;
         private int numberItemsHorizontally_ = 1;
         private int numberItemsVertically_ = -1;
         private Color textColor_;
@@ -162,14 +199,15 @@ namespace NPlot
         /// <param name="position">the position of the top left of the legend.</param>
         /// <param name="plots">Array of plot objects to appear in the legend.</param>
         /// <param name="scale">if the legend is set to scale, the amount to scale by.</param>
-        /// >
-        /// <returns></returns>
-        /// <remarks>do implementation that doesn't call draw. Change xPos, yPos to PointF</remarks>
+        /// <returns>the bounding box.</returns>
+        /// <remarks>
+        /// The layout worked out by the last Draw is used if it is still current, so
+        /// nothing is measured.
+        /// </remarks>
         public Rectangle GetBoundingBox(Point position, ArrayList plots, float scale)
         {
-            System.Drawing.Bitmap b = new System.Drawing.Bitmap(1, 1);
-            Graphics g = Graphics.FromImage(b);
-            return Draw(g, position, plots, scale);
+            Layout layout = GetLayout(null, plots, scale);
+            return new Rectangle(position.X, position.Y, layout.TotalWidth, layout.TotalHeight);
         }
 
         /// <summary>
@@ -182,20 +220,205 @@ namespace NPlot
         /// <returns>bounding box</returns>
         public Rectangle Draw(Graphics g, Point position, ArrayList plots, float scale)
         {
+            Layout layout = GetLayout(g, plots, scale);
+
+            int boxWidth = layout.BoxWidth;
+            int boxHeight = layout.BoxHeight;
+
+            // draw box around the legend.
+
+            if (BorderStyle == BorderType.Line)
+            {
+                using (Brush b = new SolidBrush(bgColor_))
+                {
+                    g.FillRectangle(b, position.X, position.Y, boxWidth, boxHeight);
+                }
+                using (Pen p = new Pen(borderColor_))
+                {
+                    g.DrawRectangle(p, position.X, position.Y, boxWidth, boxHeight);
+                }
+            }
+            else if (BorderStyle == BorderType.Shadow)
+            {
+                int offset = layout.ShadowOffset;
+                using (Brush b = new SolidBrush(Color.FromArgb(128, Color.Gray)))
+                {
+                    g.FillRectangle(b, position.X + offset, position.Y + offset, boxWidth, boxHeight);
+                }
+                using (Brush b = new SolidBrush(bgColor_))
+                {
+                    g.FillRectangle(b, position.X, position.Y, boxWidth, boxHeight);
+                }
+                using (Pen p = new Pen(borderColor_))
+                {
+                    g.DrawRectangle(p, position.X, position.Y, boxWidth, boxHeight);
+                }
+            }
+
+                /*
+			   else if ( this.BorderStyle == BorderType.Curved )
+			   {
+				   // TODO. make this nice.
+			   }
+			*/
+
+            else
+            {
+                // do nothing.
+            }
+
+            // now draw entries in box..
+            bool extendingVertically = numberItemsVertically_ == -1;
+            int hSpacing = layout.HSpacing;
+            int vSpacing = layout.VSpacing;
+            int maxWd = layout.MaxWidth;
+            int maxHt = layout.MaxHeight;
+
+            using (Brush textBrush = new SolidBrush(textColor_))
+            {
+                for (int plotCount = 0; plotCount < layout.Plots.Length; ++plotCount)
+                {
+                    int xpos, ypos;
+                    if (extendingVertically)
+                    {
+                        xpos = plotCount%numberItemsHorizontally_;
+                        ypos = plotCount/numberItemsHorizontally_;
+                    }
+                    else
+                    {
+                        xpos = plotCount/numberItemsVertically_;
+                        ypos = plotCount%numberItemsVertically_;
+                    }
+
+                    int lineXPos = (int) (position.X + hSpacing + xpos*(lineLength_ + maxWd + hSpacing*2.0f));
+                    int lineYPos = (position.Y + vSpacing + ypos*(vSpacing + maxHt));
+                    layout.Plots[plotCount].DrawInLegend(g, new Rectangle(lineXPos, lineYPos, lineLength_, maxHt));
+
+                    int textXPos = lineXPos + hSpacing + lineLength_;
+                    int textYPos = lineYPos;
+                    g.DrawString(layout.Text[plotCount], layout.TextFont, textBrush, textXPos, textYPos);
+                }
+            }
+
+            return new Rectangle(position.X, position.Y, layout.TotalWidth, layout.TotalHeight);
+        }
+
+        /// <summary>
+        /// Discards the kept layout, so that the legend is measured again the next
+        /// time it is drawn.
+        /// </summary>
+        public void InvalidateLayout()
+        {
+            layout_ = null;
+        }
+
+        /// <summary>
+        /// Gets the layout of the legend, working it out again only if something it
+        /// depends on has changed.
+        /// </summary>
+        /// <param name="g">the surface the legend is to be drawn on, or null if the
+        /// legend is only being measured, in which case the layout last used to draw
+        /// is acceptable whatever surface it was for.</param>
+        /// <param name="plots">Array of plot objects to appear in the legend.</param>
+        /// <param name="scale">if the legend is set to scale, the amount to scale by.</param>
+        private Layout GetLayout(Graphics g, ArrayList plots, float scale)
+        {
+            if (layout_ != null && IsCurrent(layout_, g, plots, scale))
+            {
+                return layout_;
+            }
+
+            Layout layout;
+            if (g == null)
+            {
+                using (System.Drawing.Bitmap b = new System.Drawing.Bitmap(1, 1))
+                using (Graphics scratch = Graphics.FromImage(b))
+                {
+                    layout = MakeLayout(scratch, plots, scale);
+                }
+            }
+            else
+            {
+                layout = MakeLayout(g, plots, scale);
+            }
+
+            if (layout_ != null && layout_.TextFont != layout_.Font)
+            {
+                layout_.TextFont.Dispose();
+            }
+            layout_ = layout;
+
+            return layout;
+        }
+
+        /// <summary>
+        /// True if the layout was worked out for the current entries and settings.
+        /// </summary>
+        private bool IsCurrent(Layout layout, Graphics g, ArrayList plots, float scale)
+        {
+            if (layout.Font != font_ || layout.AutoScaleText != AutoScaleText || layout.Scale != scale ||
+                layout.ItemsHorizontally != numberItemsHorizontally_ ||
+                layout.ItemsVertically != numberItemsVertically_ || layout.BorderStyle != BorderStyle)
+            {
+                return false;
+            }
+
+            if (g != null && (layout.DpiX != g.DpiX || layout.DpiY != g.DpiY || layout.PageUnit != g.PageUnit))
+            {
+                return false;
+            }
+
+            int count = 0;
+            for (int i = 0; i < plots.Count; ++i)
+            {
+                IPlot p = plots[i] as IPlot;
+                if (p == null || !p.ShowInLegend)
+                {
+                    continue;
+                }
+
+                if (count == layout.Plots.Length || layout.Plots[count] != p || layout.Labels[count] != p.Label)
+                {
+                    return false;
+                }
+
+                ++count;
+            }
+
+            return count == layout.Plots.Length;
+        }
+
+        /// <summary>
+        /// Works out the layout of the legend.
+        /// </summary>
+        private Layout MakeLayout(Graphics g, ArrayList plots, float scale)
+        {
+            Layout layout = new Layout();
+            layout.Font = font_;
+            layout.AutoScaleText = AutoScaleText;
+            layout.Scale = scale;
+            layout.ItemsHorizontally = numberItemsHorizontally_;
+            layout.ItemsVertically = numberItemsVertically_;
+            layout.BorderStyle = BorderStyle;
+            layout.DpiX = g.DpiX;
+            layout.DpiY = g.DpiY;
+            layout.PageUnit = g.PageUnit;
+
             // first of all determine the Font to use in the legend.
-            Font textFont;
             if (AutoScaleText)
             {
-                textFont = Utils.ScaleFont(font_, scale);
+                layout.TextFont = Utils.ScaleFont(font_, scale);
             }
             else
             {
-                textFont = font_;
+                layout.TextFont = font_;
             }
 
             // determine max width and max height of label strings and
             // count the labels. 
-            int labelCount = 0;
+            ArrayList shown = new ArrayList();
+            ArrayList labels = new ArrayList();
+            ArrayList text = new ArrayList();
             int maxHt = 0;
             int maxWd = 0;
             int unnamedCount = 0;
@@ -213,12 +436,16 @@ namespace NPlot
                     continue;
                 }
                 string label = p.Label;
+                shown.Add(p);
+                labels.Add(label);
                 if (label == "")
                 {
                     unnamedCount += 1;
                     label = "Series " + unnamedCount.ToString();
                 }
-                SizeF labelSize = g.MeasureString(label, textFont);
+                text.Add(label);
+
+                SizeF labelSize = g.MeasureString(label, layout.TextFont);
                 if (labelSize.Height > maxHt)
                 {
                     maxHt = (int) labelSize.Height;
@@ -227,10 +454,13 @@ namespace NPlot
                 {
                     maxWd = (int) labelSize.Width;
                 }
-
-                ++labelCount;
             }
 
+            layout.Plots = (IPlot[]) shown.ToArray(typeof (IPlot));
+            layout.Labels = (string[]) labels.ToArray(typeof (string));
+            layout.Text = (string[]) text.ToArray(typeof (string));
+            int labelCount = layout.Plots.Length;
+
             bool extendingHorizontally = numberItemsHorizontally_ == -1;
             bool extendingVertically = numberItemsVertically_ == -1;
 
@@ -278,97 +508,25 @@ namespace NPlot
                     heightInItemCount += 1;
             }
 
-            int lineLength = 20;
             int hSpacing = (int) (5.0f*scale);
             int vSpacing = (int) (3.0f*scale);
-            int boxWidth = (int) (widthInItemCount*(lineLength + maxWd + hSpacing*2.0f) + hSpacing);
-            int boxHeight = (int) ((float) heightInItemCount*(maxHt + vSpacing) + vSpacing);
-
-            int totalWidth = boxWidth;
-            int totalHeight = boxHeight;
-
-            // draw box around the legend.
-
-            if (BorderStyle == BorderType.Line)
+            layout.MaxWidth = maxWd;
+            layout.MaxHeight = maxHt;
+            layout.HSpacing = hSpacing;
+            layout.VSpacing = vSpacing;
+            layout.BoxWidth = (int) (widthInItemCount*(lineLength_ + maxWd + hSpacing*2.0f) + hSpacing);
+            layout.BoxHeight = (int) ((float) heightInItemCount*(maxHt + vSpacing) + vSpacing);
+            layout.TotalWidth = layout.BoxWidth;
+            layout.TotalHeight = layout.BoxHeight;
+
+            if (BorderStyle == BorderType.Shadow)
             {
-                g.FillRectangle(new SolidBrush(bgColor_), position.X, position.Y, boxWidth, boxHeight);
-                g.DrawRectangle(new Pen(borderColor_), position.X, position.Y, boxWidth, boxHeight);
+                layout.ShadowOffset = (int) (4.0f*scale);
+                layout.TotalWidth += layout.ShadowOffset;
+                layout.TotalHeight += layout.ShadowOffset;
             }
-            else if (BorderStyle == BorderType.Shadow)
-            {
-                int offset = (int) (4.0f*scale);
-                g.FillRectangle(new SolidBrush(Color.FromArgb(128, Color.Gray)), position.X + offset, position.Y + offset, boxWidth, boxHeight);
-                g.FillRectangle(new SolidBrush(bgColor_), position.X, position.Y, boxWidth, boxHeight);
-                g.DrawRectangle(new Pen(borderColor_), position.X, position.Y, boxWidth, boxHeight);
 
-                totalWidth += offset;
-                totalHeight += offset;
-            }
-
-                /*
-			   else if ( this.BorderStyle == BorderType.Curved )
-			   {
-				   // TODO. make this nice.
-			   }
-			*/
-
-            else
-            {
-                // do nothing.
-            }
-
-            // now draw entries in box..
-            labelCount = 0;
-            unnamedCount = 0;
-
-            int plotCount = -1;
-            for (int i = 0; i < plots.Count; ++i)
-            {
-                if (!(plots[i] is IPlot))
-                {
-                    continue;
-                }
-
-                IPlot p = (IPlot) plots[i];
-
-                if (!p.ShowInLegend)
-                {
-                    continue;
-                }
-
-                plotCount += 1;
-
-                int xpos, ypos;
-                if (extendingVertically)
-                {
-                    xpos = plotCount%numberItemsHorizontally_;
-                    ypos = plotCount/numberItemsHorizontally_;
-                }
-                else
-                {
-                    xpos = plotCount/numberItemsVertically_;
-                    ypos = plotCount%numberItemsVertically_;
-                }
-
-                int lineXPos = (int) (position.X + hSpacing + xpos*(lineLength + maxWd + hSpacing*2.0f));
-                int lineYPos = (position.Y + vSpacing + ypos*(vSpacing + maxHt));
-                p.DrawInLegend(g, new Rectangle(lineXPos, lineYPos, lineLength, maxHt));
-
-                int textXPos = lineXPos + hSpacing + lineLength;
-                int textYPos = lineYPos;
-                string label = p.Label;
-                if (label == "")
-                {
-                    unnamedCount += 1;
-                    label = "Series " + unnamedCount.ToString();
-                }
-
-                g.DrawString(label, textFont,
-                             new SolidBrush(textColor_), textXPos, textYPos);
-
-                ++labelCount;
-            }
-            return new Rectangle(position.X, position.Y, totalWidth, totalHeight);
+            return layout;
         }
     }
 }
\ No newline at end of file
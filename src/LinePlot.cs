@@ -34,7 +34,7 @@ namespace NPlot
     /// <summary>
     /// Encapsulates functionality for plotting data as a line chart.
     /// </summary>
-    public class LinePlot : BaseSequencePlot, IPlot, ISequencePlot
+    public class LinePlot : BaseSequencePlot, IPlot, ISequencePlot, IPreviewDrawable
     {
         private Pen pen_ = new Pen(Color.Black);
         private Color shadowColor_ = Color.FromArgb(100, 100, 100);
@@ -139,6 +139,115 @@ namespace NPlot
             DrawLineOrShadow(g, xAxis, yAxis, false);
         }
 
+        /// <summary>
+        /// Draws a decimated version of the line plot. Within each column of the given
+        /// width only the first, lowest, highest and last points are kept, which keeps
+        /// the envelope of the line intact. The shadow is not drawn.
+        /// </summary>
+        /// <param name="g">The GDI+ surface on which to draw.</param>
+        /// <param name="xAxis">The X-Axis to draw against.</param>
+        /// <param name="yAxis">The Y-Axis to draw against.</param>
+        /// <param name="decimation">The width in pixels of the columns.</param>
+        public void DrawPreview(Graphics g, PhysicalAxis xAxis, PhysicalAxis yAxis, int decimation)
+        {
+            SequenceAdapter data =
+                new SequenceAdapter(DataSource, DataMember, OrdinateData, AbscissaData, AbscissaSorted);
+
+            if (decimation < 1 || data.Count < 2)
+            {
+                Draw(g, xAxis, yAxis);
+                return;
+            }
+
+            double leftCutoff = xAxis.PhysicalToWorld(xAxis.PhysicalMin, false);
+            double rightCutoff = xAxis.PhysicalToWorld(xAxis.PhysicalMax, false);
+            if (leftCutoff > rightCutoff)
+            {
+                Utils.Swap(ref leftCutoff, ref rightCutoff);
+            }
+
+            int first = 0;
+            int last = data.Count - 1;
+            if (!xAxis.ReferencePath)
+            {
+                data.GetIndexRange(leftCutoff, rightCutoff, out first, out last);
+            }
+
+            int n = last - first + 1;
+            double[] worldX;
+            double[] worldY;
+            float[] physicalX;
+            float[] physicalY;
+            GetTransformBuffers(n, out worldX, out worldY, out physicalX, out physicalY);
+            data.CopyTo(first, n, worldX, worldY);
+
+            xAxis.WorldToPhysical(worldX, 0, n, physicalX, null);
+            yAxis.WorldToPhysical(worldY, 0, n, null, physicalY);
+
+            // the decimated points of the current unbroken run of the line.
+            PointF[] line = new PointF[n];
+            int lineCount = 0;
+
+            // the current column, as indices of its first, lowest, highest and last points.
+            int column = 0;
+            int columnFirst = -1;
+            int columnLow = -1;
+            int columnHigh = -1;
+            int columnLast = -1;
+
+            for (int i = 0; i <= n; ++i)
+            {
+                bool valid = i < n &&
+                             !Double.IsNaN(worldX[i]) && !Double.IsNaN(worldY[i]) &&
+                             !Single.IsNaN(physicalX[i]) && !Single.IsNaN(physicalY[i]);
+
+                int c = valid ? (int) Math.Floor(physicalX[i]/decimation) : 0;
+
+                if (columnFirst >= 0 && (!valid || c != column))
+                {
+                    // column finished, keep its points in order.
+                    int[] keep = {columnFirst, columnLow, columnHigh, columnLast};
+                    Array.Sort(keep);
+                    for (int k = 0; k < keep.Length; ++k)
+                    {
+                        if (k == 0 || keep[k] != keep[k - 1])
+                        {
+                            line[lineCount++] = new PointF(physicalX[keep[k]], physicalY[keep[k]]);
+                        }
+                    }
+                    columnFirst = -1;
+                }
+
+                if (!valid)
+                {
+                    // line broken (or finished), draw what we have.
+                    if (lineCount > 1)
+                    {
+                        PointF[] points = new PointF[lineCount];
+                        Array.Copy(line, points, lineCount);
+                        g.DrawLines(Pen, points);
+                    }
+                    lineCount = 0;
+                    continue;
+                }
+
+                if (columnFirst < 0)
+                {
+                    column = c;
+                    columnFirst = i;
+                    columnLow = i;
+                    columnHigh = i;
+                }
+
+                // physical y increases downwards, but either way round is fine here.
+                if (physicalY[i] < physicalY[columnLow])
+                    columnLow = i;
+                if (physicalY[i] > physicalY[columnHigh])
+                    columnHigh = i;
+                columnLast = i;
+            }
+        }
+
         /// <summary>
         /// Returns an x-axis that is suitable for drawing this plot.
         /// </summary>
@@ -191,7 +300,7 @@ namespace NPlot
             }
 
             SequenceAdapter data =
-                new SequenceAdapter(DataSource, DataMember, OrdinateData, AbscissaData);
+                new SequenceAdapter(DataSource, DataMember, OrdinateData, AbscissaData, AbscissaSorted);
 
             ITransform2D t = Transform2D.GetTransformer(xAxis, yAxis);
 
@@ -239,13 +348,33 @@ namespace NPlot
                     rightCutoff -= shadowCorrection;
                 }
 
-                for (int i = 1; i < numberPoints; ++i)
+                // only consider points near the visible range.
+                int first = 0;
+                int last = data.Count - 1;
+                if (!xAxis.ReferencePath)
+                {
+                    data.GetIndexRange(leftCutoff, rightCutoff, out first, out last);
+                }
+
+                // transform the whole run in one go.
+                int n = last - first + 1;
+                double[] worldX;
+                double[] worldY;
+                float[] physicalX;
+                float[] physicalY;
+                GetTransformBuffers(n, out worldX, out worldY, out physicalX, out physicalY);
+                data.CopyTo(first, n, worldX, worldY);
+
+                xAxis.WorldToPhysical(worldX, 0, n, physicalX, null);
+                yAxis.WorldToPhysical(worldY, 0, n, null, physicalY);
+
+                for (int i = 1; i < n; ++i)
                 {
                     // check to see if any values null. If so, then continue.
-                    double dx1 = data[i - 1].X;
-                    double dx2 = data[i].X;
-                    double dy1 = data[i - 1].Y;
-                    double dy2 = data[i].Y;
+                    double dx1 = worldX[i - 1];
+                    double dx2 = worldX[i];
+                    double dy1 = worldY[i - 1];
+                    double dy2 = worldY[i];
                     if (Double.IsNaN(dx1) || Double.IsNaN(dy1) ||
                         Double.IsNaN(dx2) || Double.IsNaN(dy2))
                     {
@@ -260,8 +389,13 @@ namespace NPlot
                     }
 
                     // else draw line.
-                    PointF p1 = t.Transform(data[i - 1]);
-                    PointF p2 = t.Transform(data[i]);
+                    PointF p1 = new PointF(physicalX[i - 1], physicalY[i - 1]);
+                    PointF p2 = new PointF(physicalX[i], physicalY[i]);
+
+                    // not transformable, eg. non-positive on a log axis.
+                    if (Single.IsNaN(p1.X) || Single.IsNaN(p1.Y) ||
+                        Single.IsNaN(p2.X) || Single.IsNaN(p2.Y))
+                        continue;
 
                     // when very far zoomed in, points can fall ontop of each other,
                     // and g.DrawLine throws an overflow exception
@@ -571,6 +571,98 @@ namespace NPlot
             return new PointF(physicalMin.X + offset.X, physicalMin.Y + offset.Y);
         }
 
+        /// <summary>
+        /// World to physical coordinate transform of many values at once. The result
+        /// is the same as calling WorldToPhysical with clip false for each value, except
+        /// that values which are not positive transform to NaN rather than causing an
+        /// exception to be thrown.
+        /// </summary>
+        /// <remarks>
+        /// Logarithms are taken with FastLog10 unless its error could amount to a
+        /// noticeable fraction of a pixel, which only happens when zoomed in to a
+        /// tiny fraction of a decade.
+        /// </remarks>
+        /// <param name="coords">The coordinate values to transform.</param>
+        /// <param name="start">Index in coords of the first value to transform.</param>
+        /// <param name="count">The number of values to transform.</param>
+        /// <param name="physicalMin">The physical position corresponding to the world minimum of the axis.</param>
+        /// <param name="physicalMax">The physical position corresponding to the world maximum of the axis.</param>
+        /// <param name="x">If not null, receives the physical x positions, starting at index 0.</param>
+        /// <param name="y">If not null, receives the physical y positions, starting at index 0.</param>
+        public override void WorldToPhysical(
+            double[] coords, int start, int count,
+            PointF physicalMin, PointF physicalMax,
+            float[] x, float[] y)
+        {
+            float physicalX = physicalMax.X - physicalMin.X;
+            float physicalY = physicalMax.Y - physicalMin.Y;
+
+            double logMin = Math.Log10(WorldMin);
+            double lrange = (Math.Log10(WorldMax) - logMin);
+
+            double physicalLength = Math.Sqrt((double) physicalX*physicalX + (double) physicalY*physicalY);
+            bool fast = Math.Abs(fastLog10Error_*physicalLength) < 0.01*Math.Abs(lrange);
+
+            for (int i = 0; i < count; ++i)
+            {
+                double coord = coords[start + i];
+
+                if (!(coord > 0.0))
+                {
+                    if (x != null)
+                        x[i] = Single.NaN;
+                    if (y != null)
+                        y[i] = Single.NaN;
+                    continue;
+                }
+
+                double log = fast ? FastLog10(coord) : Math.Log10(coord);
+                double prop = ((log - logMin)/lrange);
+
+                if (x != null)
+                    x[i] = physicalMin.X + (float) (prop*physicalX);
+                if (y != null)
+                    y[i] = physicalMin.Y + (float) (prop*physicalY);
+            }
+        }
+
+        // upper bound on the absolute error of FastLog10.
+        private const double fastLog10Error_ = 1.0e-9;
+
+        /// <summary>
+        /// Base 10 logarithm of a positive value, without a call into the runtime
+        /// library. The value is split into its binary exponent and a mantissa m in
+        /// [sqrt(1/2), sqrt(2)), and ln(m) = 2 atanh((m-1)/(m+1)) is found from the
+        /// first five terms of its series. The error is below 1e-9.
+        /// </summary>
+        /// <param name="v">value to take the logarithm of.</param>
+        /// <returns>the base 10 logarithm of v.</returns>
+        private static double FastLog10(double v)
+        {
+            long bits = BitConverter.DoubleToInt64Bits(v);
+            int exponent = (int) ((bits >> 52) & 0x7FF);
+
+            // subnormals and infinity.
+            if (exponent == 0 || exponent == 0x7FF)
+            {
+                return Math.Log10(v);
+            }
+
+            double m = BitConverter.Int64BitsToDouble((bits & 0x000FFFFFFFFFFFFFL) | 0x3FF0000000000000L);
+            exponent -= 1023;
+            if (m > 1.4142135623730951)
+            {
+                m *= 0.5;
+                exponent += 1;
+            }
+
+            double s = (m - 1.0)/(m + 1.0);
+            double s2 = s*s;
+            double ln = 2.0*s*(1.0 + s2*(1.0/3.0 + s2*(1.0/5.0 + s2*(1.0/7.0 + s2*(1.0/9.0)))));
+
+            return (exponent*0.69314718055994531 + ln)*0.43429448190325183;
+        }
+
         /// <summary>
         /// Return the world coordinate of the projection of the point p onto
         /// the axis.
@@ -0,0 +1,535 @@
+/*
+ * NPlot - A charting library for .NET
+ * 
+ * MultiLinePlot.cs
+ * Copyright (C) 2003-2006 Matt Howlett and others.
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+using System;
+using System.Collections;
+using System.Data;
+using System.Drawing;
+using System.Text;
+
+namespace NPlot
+{
+    /// <summary>
+    /// Plots a number of series that share the same abscissa data as line charts. The
+    /// abscissa values are read and transformed once per draw, rather than once per
+    /// series as they would be with a LinePlot for each, and the visible range and
+    /// preview columns are worked out once and used for all series.
+    /// </summary>
+    /// <remarks>
+    /// All series must have the same number of points. The whole plot has a single
+    /// entry in the legend, drawn with the first pen.
+    /// </remarks>
+    public class MultiLinePlot : BasePlot, IPlot, IPreviewDrawable
+    {
+        private static readonly Color[] defaultColors_ =
+            {
+                Color.Blue, Color.Red, Color.Green, Color.DarkOrange,
+                Color.Purple, Color.Brown, Color.Teal, Color.Magenta
+            };
+
+        private readonly ArrayList pens_ = new ArrayList();
+        private Pen[] defaultPens_;
+
+        private double[] worldX_;
+        private double[] worldY_;
+        private float[] physicalX_;
+        private float[] physicalY_;
+        private int[] columns_;
+        private PointF[] line_;
+        private PointF[][] runs_;
+
+        /// <summary>
+        /// Default constructor
+        /// </summary>
+        public MultiLinePlot()
+        {
+        }
+
+        /// <summary>
+        /// Constructor
+        /// </summary>
+        /// <param name="dataSource">The data source to associate with this plot</param>
+        /// <param name="abscissaData">the name of the abscissa column. All other columns are plotted.</param>
+        public MultiLinePlot(object dataSource, object abscissaData)
+        {
+            DataSource = dataSource;
+            AbscissaData = abscissaData;
+        }
+
+        /// <summary>
+        /// Constructor
+        /// </summary>
+        /// <param name="ordinateData">the ordinate data of each series.</param>
+        /// <param name="abscissaData">the abscissa data shared by the series.</param>
+        public MultiLinePlot(IList ordinateData, object abscissaData)
+        {
+            OrdinateData = ordinateData;
+            AbscissaData = abscissaData;
+        }
+
+        /// <summary>
+        /// Gets or sets the data, or column name for the abscissa [x] axis, shared by
+        /// all series.
+        /// </summary>
+        public object AbscissaData { get; set; }
+
+        /// <summary>
+        /// Gets or sets the ordinate [y] data of the series: one entry per series, each
+        /// being data or a column name as for the OrdinateData of a LinePlot. If null and
+        /// the DataSource is a DataTable, DataView or DataSet, every column other than
+        /// the abscissa column is plotted.
+        /// </summary>
+        public IList OrdinateData { get; set; }
+
+        /// <summary>
+        /// Set this to true if the abscissa data is known to be in ascending order
+        /// and contains no NaN values. See BaseSequencePlot.AbscissaSorted.
+        /// </summary>
+        public bool AbscissaSorted { get; set; }
+
+        /// <summary>
+        /// The pens used to draw the series, the ith series being drawn with the ith
+        /// pen. If there are fewer pens than series they are reused in turn. If empty,
+        /// a default set of colors is used.
+        /// </summary>
+        public ArrayList Pens
+        {
+            get { return pens_; }
+        }
+
+        /// <summary>
+        /// The number of series.
+        /// </summary>
+        public int SeriesCount
+        {
+            get { return Ordinates().Count; }
+        }
+
+        /// <summary>
+        /// Gets the pen the given series is drawn with.
+        /// </summary>
+        /// <param name="series">the index of the series.</param>
+        /// <returns>the pen.</returns>
+        public Pen PenFor(int series)
+        {
+            if (pens_.Count > 0)
+            {
+                return (Pen) pens_[series%pens_.Count];
+            }
+
+            if (defaultPens_ == null)
+            {
+                defaultPens_ = new Pen[defaultColors_.Length];
+                for (int i = 0; i < defaultPens_.Length; ++i)
+                {
+                    defaultPens_[i] = new Pen(defaultColors_[i]);
+                }
+            }
+
+            return defaultPens_[series%defaultPens_.Length];
+        }
+
+        /// <summary>
+        /// The ordinate data of each series, worked out from the data source if
+        /// OrdinateData is null.
+        /// </summary>
+        private IList Ordinates()
+        {
+            if (OrdinateData != null)
+            {
+                return OrdinateData;
+            }
+
+            DataTable table = null;
+            if (DataSource is DataTable)
+            {
+                table = (DataTable) DataSource;
+            }
+            else if (DataSource is DataView)
+            {
+                table = ((DataView) DataSource).Table;
+            }
+            else if (DataSource is DataSet && DataMember != null)
+            {
+                table = ((DataSet) DataSource).Tables[DataMember];
+            }
+
+            ArrayList names = new ArrayList();
+            if (table != null)
+            {
+                foreach (DataColumn column in table.Columns)
+                {
+                    if (!Equals(column.ColumnName, AbscissaData))
+                    {
+                        names.Add(column.ColumnName);
+                    }
+                }
+            }
+            return names;
+        }
+
+        /// <summary>
+        /// Makes an adapter for each series, and checks they all have the same number
+        /// of points.
+        /// </summary>
+        private SequenceAdapter[] Series()
+        {
+            IList ordinates = Ordinates();
+
+            SequenceAdapter[] series = new SequenceAdapter[ordinates.Count];
+            for (int i = 0; i < series.Length; ++i)
+            {
+                series[i] = new SequenceAdapter(DataSource, DataMember, ordinates[i], AbscissaData, AbscissaSorted);
+                if (series[i].Count != series[0].Count)
+                {
+                    throw new NPlotException("All series of a MultiLinePlot must have the same number of points.");
+                }
+            }
+
+            return series;
+        }
+
+        /// <summary>
+        /// Draws the series on a GDI+ surface against the provided x and y axes.
+        /// </summary>
+        /// <param name="g">The GDI+ surface on which to draw.</param>
+        /// <param name="xAxis">The X-Axis to draw against.</param>
+        /// <param name="yAxis">The Y-Axis to draw against.</param>
+        public void Draw(Graphics g, PhysicalAxis xAxis, PhysicalAxis yAxis)
+        {
+            Draw(g, xAxis, yAxis, 0);
+        }
+
+        /// <summary>
+        /// Draws a decimated version of the series. Within each column of the given
+        /// width only the first, lowest, highest and last points of each series are
+        /// kept, which keeps the envelopes of the lines intact. The columns are found
+        /// once and used for all series.
+        /// </summary>
+        /// <param name="g">The GDI+ surface on which to draw.</param>
+        /// <param name="xAxis">The X-Axis to draw against.</param>
+        /// <param name="yAxis">The Y-Axis to draw against.</param>
+        /// <param name="decimation">The width in pixels of the columns.</param>
+        public void DrawPreview(Graphics g, PhysicalAxis xAxis, PhysicalAxis yAxis, int decimation)
+        {
+            Draw(g, xAxis, yAxis, Math.Max(decimation, 0));
+        }
+
+        private void Draw(Graphics g, PhysicalAxis xAxis, PhysicalAxis yAxis, int decimation)
+        {
+            SequenceAdapter[] series = Series();
+            if (series.Length == 0 || series[0].Count == 0)
+            {
+                return;
+            }
+
+            double leftCutoff = xAxis.PhysicalToWorld(xAxis.PhysicalMin, false);
+            double rightCutoff = xAxis.PhysicalToWorld(xAxis.PhysicalMax, false);
+            if (leftCutoff > rightCutoff)
+            {
+                Utils.Swap(ref leftCutoff, ref rightCutoff);
+            }
+
+            // the visible range and abscissa are the same for all series.
+            int first = 0;
+            int last = series[0].Count - 1;
+            if (!xAxis.ReferencePath)
+            {
+                series[0].GetIndexRange(leftCutoff, rightCutoff, out first, out last);
+            }
+
+            int n = last - first + 1;
+            GetBuffers(n, series.Length);
+
+            double[] worldX = worldX_;
+            series[0].CopyTo(first, n, worldX, null);
+
+            float[] physicalX = physicalX_;
+            xAxis.WorldToPhysical(worldX, 0, n, physicalX, null);
+
+            // the column of each point, or -1 if it has no valid abscissa.
+            int[] columns = columns_;
+            for (int i = 0; i < n; ++i)
+            {
+                if (Double.IsNaN(worldX[i]) || Single.IsNaN(physicalX[i]))
+                {
+                    columns[i] = -1;
+                }
+                else
+                {
+                    columns[i] = decimation > 0 ? (int) Math.Floor(physicalX[i]/decimation) : i;
+                }
+            }
+
+            // a single point is drawn as a short horizontal line, as by LinePlot.
+            if (n == 1 && series[0].Count == 1)
+            {
+                for (int s = 0; s < series.Length; ++s)
+                {
+                    float y = yAxis.WorldToPhysical(series[s][0].Y, false).Y;
+                    if (columns[0] >= 0 && !Single.IsNaN(y))
+                    {
+                        g.DrawLine(PenFor(s), physicalX[0] - 0.5f, y, physicalX[0] + 0.5f, y);
+                    }
+                }
+                return;
+            }
+
+            double[] worldY = worldY_;
+            float[] physicalY = physicalY_;
+
+            for (int s = 0; s < series.Length; ++s)
+            {
+                series[s].CopyTo(first, n, null, worldY);
+                yAxis.WorldToPhysical(worldY, 0, n, null, physicalY);
+
+                DrawSeries(g, PenFor(s), n, columns, decimation > 0, physicalX, worldY, physicalY, line_, ref runs_[s]);
+            }
+        }
+
+        /// <summary>
+        /// Makes sure the scratch arrays used by Draw hold at least count points, and
+        /// that there is a run array slot for each series. They are kept between draws,
+        /// and only grown, so that drawing does not allocate every time.
+        /// </summary>
+        private void GetBuffers(int count, int seriesCount)
+        {
+            if (worldX_ == null || worldX_.Length < count)
+            {
+                worldX_ = new double[count];
+                worldY_ = new double[count];
+                physicalX_ = new float[count];
+                physicalY_ = new float[count];
+                columns_ = new int[count];
+                line_ = new PointF[count];
+            }
+            if (runs_ == null || runs_.Length < seriesCount)
+            {
+                PointF[][] runs = new PointF[seriesCount][];
+                if (runs_ != null)
+                {
+                    Array.Copy(runs_, runs, runs_.Length);
+                }
+                runs_ = runs;
+            }
+        }
+
+        /// <summary>
+        /// Draws one series as unbroken runs of line between points with NaN values.
+        /// When decimating, only the first, lowest, highest and last points within
+        /// each column are kept; otherwise every valid point is used as it is.
+        /// Graphics.DrawLines takes an array of exactly the points of a run, so the
+        /// last one made for the series is kept in run and reused by runs of the same
+        /// length, which is the usual case when the view is redrawn.
+        /// </summary>
+        private static void DrawSeries(Graphics g, Pen pen, int n, int[] columns, bool decimating, float[] physicalX,
+                                       double[] worldY, float[] physicalY, PointF[] line, ref PointF[] run)
+        {
+            int lineCount = 0;
+
+            // the current column, as indices of its first, lowest, highest and last points.
+            int columnFirst = -1;
+            int columnLow = -1;
+            int columnHigh = -1;
+            int columnLast = -1;
+
+            for (int i = 0; i <= n; ++i)
+            {
+                bool valid = i < n && columns[i] >= 0 &&
+                             !Double.IsNaN(worldY[i]) && !Single.IsNaN(physicalY[i]);
+
+                if (!decimating)
+                {
+                    if (valid)
+                    {
+                        Append(line, ref lineCount, physicalX[i], physicalY[i]);
+                        continue;
+                    }
+                }
+                else if (columnFirst >= 0 && (!valid || columns[i] != columns[columnFirst]))
+                {
+                    // column finished, keep its points in order. The first and last
+                    // points bound the others, so only lowest and highest can be out
+                    // of order.
+                    int a = columnLow;
+                    int b = columnHigh;
+                    if (a > b)
+                    {
+                        a = columnHigh;
+                        b = columnLow;
+                    }
+                    Append(line, ref lineCount, physicalX[columnFirst], physicalY[columnFirst]);
+                    if (a != columnFirst)
+                        Append(line, ref lineCount, physicalX[a], physicalY[a]);
+                    if (b != a && b != columnFirst)
+                        Append(line, ref lineCount, physicalX[b], physicalY[b]);
+                    if (columnLast != b && columnLast != columnFirst)
+                        Append(line, ref lineCount, physicalX[columnLast], physicalY[columnLast]);
+                    columnFirst = -1;
+                }
+
+                if (!valid)
+                {
+                    // line broken (or finished), draw what we have.
+                    if (lineCount > 1)
+                    {
+                        if (run == null || run.Length != lineCount)
+                        {
+                            run = new PointF[lineCount];
+                        }
+                        Array.Copy(line, run, lineCount);
+                        g.DrawLines(pen, run);
+                    }
+                    lineCount = 0;
+                    continue;
+                }
+
+                if (columnFirst < 0)
+                {
+                    columnFirst = i;
+                    columnLow = i;
+                    columnHigh = i;
+                }
+
+                if (physicalY[i] < physicalY[columnLow])
+                    columnLow = i;
+                if (physicalY[i] > physicalY[columnHigh])
+                    columnHigh = i;
+                columnLast = i;
+            }
+        }
+
+        /// <summary>
+        /// Adds a point to the current run of line, unless it is on top of the last
+        /// one - GDI+ can throw on zero length lines.
+        /// </summary>
+        private static void Append(PointF[] line, ref int lineCount, float x, float y)
+        {
+            if (lineCount == 0 || line[lineCount - 1].X != x || line[lineCount - 1].Y != y)
+            {
+                line[lineCount++] = new PointF(x, y);
+            }
+        }
+
+        /// <summary>
+        /// Returns an x-axis that is suitable for drawing this plot.
+        /// </summary>
+        /// <returns>A suitable x-axis.</returns>
+        public Axis SuggestXAxis()
+        {
+            SequenceAdapter[] series = Series();
+            if (series.Length == 0)
+            {
+                return new LinearAxis(0.0, 1.0);
+            }
+
+            return series[0].SuggestXAxis();
+        }
+
+        /// <summary>
+        /// Returns a y-axis that is suitable for drawing this plot, covering the values
+        /// of all series. It is a DateTimeAxis if the first series would be given one.
+        /// </summary>
+        /// <returns>A suitable y-axis.</returns>
+        public Axis SuggestYAxis()
+        {
+            SequenceAdapter[] series = Series();
+            if (series.Length == 0)
+            {
+                return new LinearAxis(0.0, 1.0);
+            }
+
+            double min = Double.NaN;
+            double max = Double.NaN;
+
+            int n = series[0].Count;
+            double[] worldY = new double[n];
+            for (int s = 0; s < series.Length; ++s)
+            {
+                series[s].CopyTo(0, n, null, worldY);
+                for (int i = 0; i < n; ++i)
+                {
+                    double y = worldY[i];
+                    if (Double.IsNaN(y))
+                        continue;
+                    if (Double.IsNaN(min) || y < min)
+                        min = y;
+                    if (Double.IsNaN(max) || y > max)
+                        max = y;
+                }
+            }
+
+            if (Double.IsNaN(min))
+            {
+                return new LinearAxis(0.0, 1.0);
+            }
+
+            if (series[0].SuggestYAxis() is DateTimeAxis)
+            {
+                return new DateTimeAxis(min, max);
+            }
+
+            return new LinearAxis(min, max);
+        }
+
+        /// <summary>
+        /// Draws a representation of this plot in the legend.
+        /// </summary>
+        /// <param name="g">The graphics surface on which to draw.</param>
+        /// <param name="startEnd">A rectangle specifying the bounds of the area in the legend set aside for drawing.</param>
+        public virtual void DrawInLegend(Graphics g, Rectangle startEnd)
+        {
+            g.DrawLine(PenFor(0), startEnd.Left, (startEnd.Top + startEnd.Bottom)/2,
+                       startEnd.Right, (startEnd.Top + startEnd.Bottom)/2);
+        }
+
+        /// <summary>
+        /// Writes text data of the plot object to the supplied string builder, one
+        /// series after another. It is possible to specify that only data in the
+        /// specified range be written.
+        /// </summary>
+        /// <param name="sb">the StringBuilder object to write to.</param>
+        /// <param name="region">a region used if onlyInRegion is true.</param>
+        /// <param name="onlyInRegion">If true, only data enclosed in the provided region will be written.</param>
+        public void WriteData(StringBuilder sb, RectangleD region, bool onlyInRegion)
+        {
+            SequenceAdapter[] series = Series();
+
+            sb.Append("Label: ");
+            sb.Append(Label);
+            sb.Append("\r\n");
+            for (int s = 0; s < series.Length; ++s)
+            {
+                sb.Append("Series: ");
+                sb.Append(s);
+                sb.Append("\r\n");
+                series[s].WriteData(sb, region, onlyInRegion);
+            }
+        }
+    }
+}
\ No newline at end of file
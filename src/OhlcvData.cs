@@ -0,0 +1,668 @@
+/*
+ * NPlot - A charting library for .NET
+ * 
+ * OhlcvData.cs
+ * Copyright (C) 2003-2006 Matt Howlett and others.
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+using System;
+using System.Globalization;
+using System.IO;
+using System.Text;
+
+namespace NPlot
+{
+    /// <summary>
+    /// Holds open, high, low, close and volume time series data in typed columns,
+    /// and reads it from CSV text or a compact binary format without going through
+    /// a DataSet. An instance can be used as the DataSource of a CandlePlot or a
+    /// sequence plot, with the data properties set to the column names "Date",
+    /// "Open", "High", "Low", "Close" and "Volume". Dates are treated as DateTime
+    /// values, so a DateTimeAxis is suggested for them.
+    /// </summary>
+    public class OhlcvData
+    {
+        /// <summary>
+        /// The names of the columns, in the order they are stored in the binary format.
+        /// </summary>
+        public static readonly string[] ColumnNames = {"Date", "Open", "High", "Low", "Close", "Volume"};
+
+        private const string magic_ = "NPLOHLCV";
+        private const int version_ = 1;
+        private const int chunkSize_ = 1 << 16;
+
+        // these will be exact, and a number of the form mantissa / 10^n is correctly
+        // rounded if mantissa < 2^53 and n <= 22.
+        private static readonly double[] powersOfTen_ =
+            {
+                1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+            };
+
+        private readonly DataColumnCache.Column[] columns_;
+
+        /// <summary>
+        /// Constructor. All arrays must have the same length.
+        /// </summary>
+        /// <param name="date">The date of each bar, in ticks.</param>
+        /// <param name="open">The value at open of each bar.</param>
+        /// <param name="high">The high value of each bar.</param>
+        /// <param name="low">The low value of each bar.</param>
+        /// <param name="close">The value at close of each bar.</param>
+        /// <param name="volume">The volume of each bar.</param>
+        public OhlcvData(double[] date, double[] open, double[] high, double[] low, double[] close, double[] volume)
+        {
+            double[][] data = {date, open, high, low, close, volume};
+
+            columns_ = new DataColumnCache.Column[data.Length];
+            for (int i = 0; i < data.Length; ++i)
+            {
+                if (data[i].Length != date.Length)
+                    throw new NPlotException("All OHLCV columns must have the same length.");
+                columns_[i] = new DataColumnCache.Column(data[i], i == 0);
+            }
+        }
+
+        /// <summary>
+        /// The number of bars.
+        /// </summary>
+        public int Count
+        {
+            get { return Date.Length; }
+        }
+
+        /// <summary>
+        /// The date of each bar, in ticks.
+        /// </summary>
+        public double[] Date
+        {
+            get { return columns_[0].Data; }
+        }
+
+        /// <summary>
+        /// The value at open of each bar.
+        /// </summary>
+        public double[] Open
+        {
+            get { return columns_[1].Data; }
+        }
+
+        /// <summary>
+        /// The high value of each bar.
+        /// </summary>
+        public double[] High
+        {
+            get { return columns_[2].Data; }
+        }
+
+        /// <summary>
+        /// The low value of each bar.
+        /// </summary>
+        public double[] Low
+        {
+            get { return columns_[3].Data; }
+        }
+
+        /// <summary>
+        /// The value at close of each bar.
+        /// </summary>
+        public double[] Close
+        {
+            get { return columns_[4].Data; }
+        }
+
+        /// <summary>
+        /// The volume of each bar. NaN where the volume was not provided.
+        /// </summary>
+        public double[] Volume
+        {
+            get { return columns_[5].Data; }
+        }
+
+        /// <summary>
+        /// Gets a column by name (case insensitive).
+        /// </summary>
+        /// <param name="columnName">One of the names in ColumnNames.</param>
+        /// <returns>The column.</returns>
+        public DataColumnCache.Column this[string columnName]
+        {
+            get
+            {
+                int i = IndexOf(columnName);
+                if (i < 0)
+                    throw new NPlotException("OHLCV data does not contain column: " + columnName);
+                return columns_[i];
+            }
+        }
+
+        #region CSV
+
+        /// <summary>
+        /// Reads CSV data from a file. See ReadCsv(TextReader).
+        /// </summary>
+        /// <param name="path">The path of the file to read.</param>
+        /// <returns>The data read.</returns>
+        public static OhlcvData ReadCsv(string path)
+        {
+            using (StreamReader reader = new StreamReader(path, Encoding.UTF8, true, chunkSize_))
+            {
+                return ReadCsv(reader);
+            }
+        }
+
+        /// <summary>
+        /// Reads CSV data. The first line must be a header naming the columns, which
+        /// are matched case insensitively: a date column (named Date, Time, DateTime or
+        /// Timestamp), Open, High, Low, Close and optionally Volume. Other columns are
+        /// ignored. Fields may be separated by commas, semicolons or tabs.
+        /// </summary>
+        /// <remarks>
+        /// Numbers are parsed using the invariant culture. Dates in the forms
+        /// yyyy-MM-dd, yyyyMMdd, and yyyy-MM-dd followed by 'T' or ' ' and HH:mm[:ss[.f...]]
+        /// are parsed directly, anything else is handed to DateTime.Parse. Dates with a
+        /// time zone are converted to UTC, those without are used as written. Lines are
+        /// parsed from a reused buffer, so no per-row strings are created in the
+        /// common case.
+        /// </remarks>
+        /// <param name="reader">The reader to read from.</param>
+        /// <returns>The data read.</returns>
+        public static OhlcvData ReadCsv(TextReader reader)
+        {
+            string header = reader.ReadLine();
+            if (header == null)
+                throw new NPlotException("CSV data is empty.");
+
+            char separator = ',';
+            if (header.IndexOf('\t') >= 0)
+                separator = '\t';
+            else if (header.IndexOf(',') < 0 && header.IndexOf(';') >= 0)
+                separator = ';';
+
+            // which of our columns each field of a line goes to, -1 if none.
+            string[] fields = header.Split(separator);
+            int[] target = new int[fields.Length];
+            bool[] found = new bool[ColumnNames.Length];
+            for (int i = 0; i < fields.Length; ++i)
+            {
+                string name = fields[i].Trim().Trim('"');
+                if (string.Compare(name, "Time", true, CultureInfo.InvariantCulture) == 0 ||
+                    string.Compare(name, "DateTime", true, CultureInfo.InvariantCulture) == 0 ||
+                    string.Compare(name, "Timestamp", true, CultureInfo.InvariantCulture) == 0)
+                {
+                    name = "Date";
+                }
+
+                target[i] = IndexOf(name);
+                if (target[i] >= 0)
+                {
+                    if (found[target[i]])
+                        throw new NPlotException("CSV header names column more than once: " + name);
+                    found[target[i]] = true;
+                }
+            }
+            for (int i = 0; i < 5; ++i)
+            {
+                if (!found[i])
+                    throw new NPlotException("CSV header does not name column: " + ColumnNames[i]);
+            }
+
+            Builder builder = new Builder();
+            char[] buffer = new char[chunkSize_];
+            int start = 0;
+            int end = 0;
+            int lineNumber = 1;
+
+            while (true)
+            {
+                int newline = Array.IndexOf(buffer, '\n', start, end - start);
+                if (newline < 0)
+                {
+                    // move the partial line to the start of the buffer, and read more.
+                    if (start > 0)
+                    {
+                        Array.Copy(buffer, start, buffer, 0, end - start);
+                        end -= start;
+                        start = 0;
+                    }
+                    if (end == buffer.Length)
+                    {
+                        char[] bigger = new char[buffer.Length*2];
+                        Array.Copy(buffer, bigger, end);
+                        buffer = bigger;
+                    }
+
+                    int read = reader.Read(buffer, end, buffer.Length - end);
+                    if (read > 0)
+                    {
+                        end += read;
+                        continue;
+                    }
+
+                    if (start == end)
+                        break;
+                    newline = end;
+                }
+
+                ++lineNumber;
+                int lineEnd = newline;
+                if (lineEnd > start && buffer[lineEnd - 1] == '\r')
+                    --lineEnd;
+                if (lineEnd > start)
+                    ParseLine(buffer, start, lineEnd, separator, target, builder, lineNumber);
+
+                start = Math.Min(newline + 1, end);
+            }
+
+            return builder.ToData();
+        }
+
+        private static void ParseLine(char[] buffer, int start, int end, char separator, int[] target,
+                                      Builder builder, int lineNumber)
+        {
+            builder.BeginRow();
+
+            int field = 0;
+            int fieldStart = start;
+            for (int i = start; i <= end; ++i)
+            {
+                if (i < end && buffer[i] != separator)
+                    continue;
+
+                if (field < target.Length && target[field] >= 0)
+                {
+                    int s = fieldStart;
+                    int e = i;
+                    while (s < e && (buffer[s] == ' ' || buffer[s] == '"')) ++s;
+                    while (e > s && (buffer[e - 1] == ' ' || buffer[e - 1] == '"')) --e;
+
+                    try
+                    {
+                        if (target[field] == 0)
+                            builder.Set(0, ParseDate(buffer, s, e));
+                        else
+                            builder.Set(target[field], ParseDouble(buffer, s, e));
+                    }
+                    catch (FormatException ex)
+                    {
+                        throw ParseError(buffer, s, e, lineNumber, ex);
+                    }
+                    catch (ArgumentOutOfRangeException ex)
+                    {
+                        // a well formed date that does not exist, eg month 13.
+                        throw ParseError(buffer, s, e, lineNumber, ex);
+                    }
+                    catch (OverflowException ex)
+                    {
+                        // a number too large for a double.
+                        throw ParseError(buffer, s, e, lineNumber, ex);
+                    }
+                }
+
+                ++field;
+                fieldStart = i + 1;
+            }
+        }
+
+        private static NPlotException ParseError(char[] b, int start, int end, int lineNumber, Exception inner)
+        {
+            return new NPlotException(
+                "Could not parse '" + new string(b, start, end - start) + "' on line " + lineNumber + " of CSV data.", inner);
+        }
+
+        private static double ParseDouble(char[] b, int start, int end)
+        {
+            if (start == end)
+                return double.NaN;
+
+            int i = start;
+            bool negative = false;
+            if (b[i] == '-' || b[i] == '+')
+            {
+                negative = b[i] == '-';
+                ++i;
+            }
+
+            long mantissa = 0;
+            bool anyDigits = false;
+            int digits = 0;
+            int fractionDigits = 0;
+            bool point = false;
+            for (; i < end; ++i)
+            {
+                char c = b[i];
+                if (c >= '0' && c <= '9')
+                {
+                    anyDigits = true;
+                    if (digits < 18)
+                    {
+                        mantissa = mantissa*10 + (c - '0');
+                        if (mantissa != 0)
+                            ++digits;
+                        if (point)
+                            ++fractionDigits;
+                    }
+                    else
+                    {
+                        // too many significant digits for the fast path.
+                        digits = int.MaxValue;
+                        break;
+                    }
+                }
+                else if (c == '.' && !point)
+                {
+                    point = true;
+                }
+                else
+                {
+                    break;
+                }
+            }
+
+            if (i == end && anyDigits && digits <= 15 && fractionDigits <= 22)
+            {
+                double v = mantissa/powersOfTen_[fractionDigits];
+                return negative ? -v : v;
+            }
+
+            // exponents, long mantissas, NaN etc.
+            return double.Parse(new string(b, start, end - start), NumberStyles.Float, CultureInfo.InvariantCulture);
+        }
+
+        private static double ParseDate(char[] b, int start, int end)
+        {
+            int length = end - start;
+            if (length == 0)
+                return double.NaN;
+
+            int year;
+            int month;
+            int day;
+            int pos;
+
+            if (length == 8 && Digits(b, start, 8, out year))
+            {
+                // yyyyMMdd
+                day = year%100;
+                month = (year/100)%100;
+                year /= 10000;
+                return new DateTime(year, month, day).Ticks;
+            }
+
+            if (length >= 10 && b[start + 4] == '-' && b[start + 7] == '-' &&
+                Digits(b, start, 4, out year) && Digits(b, start + 5, 2, out month) && Digits(b, start + 8, 2, out day))
+            {
+                pos = start + 10;
+                if (pos == end)
+                    return new DateTime(year, month, day).Ticks;
+
+                int hour;
+                int minute;
+                int second = 0;
+                long fraction = 0;
+                if ((b[pos] == 'T' || b[pos] == ' ') && pos + 6 <= end && b[pos + 3] == ':' &&
+                    Digits(b, pos + 1, 2, out hour) && Digits(b, pos + 4, 2, out minute))
+                {
+                    pos += 6;
+                    if (pos + 3 <= end && b[pos] == ':' && Digits(b, pos + 1, 2, out second))
+                    {
+                        pos += 3;
+                        if (pos < end && b[pos] == '.')
+                        {
+                            ++pos;
+                            long scale = TimeSpan.TicksPerSecond;
+                            while (pos < end && b[pos] >= '0' && b[pos] <= '9')
+                            {
+                                scale /= 10;
+                                fraction += (b[pos] - '0')*scale;
+                                ++pos;
+                            }
+                        }
+                    }
+
+                    if (pos == end)
+                        return new DateTime(year, month, day, hour, minute, second).Ticks + fraction;
+                }
+            }
+
+            // time zones and other formats. Times without a zone are taken as written,
+            // as above, and those with one are converted to UTC.
+            return DateTime.Parse(new string(b, start, length), CultureInfo.InvariantCulture,
+                                  DateTimeStyles.AdjustToUniversal | DateTimeStyles.AssumeUniversal).Ticks;
+        }
+
+        private static bool Digits(char[] b, int start, int count, out int value)
+        {
+            value = 0;
+            for (int i = start; i < start + count; ++i)
+            {
+                if (b[i] < '0' || b[i] > '9')
+                    return false;
+                value = value*10 + (b[i] - '0');
+            }
+            return true;
+        }
+
+        #endregion
+
+        #region Binary
+
+        /// <summary>
+        /// Reads data in the binary format from a file. See ReadBinary(Stream).
+        /// </summary>
+        /// <param name="path">The path of the file to read.</param>
+        /// <returns>The data read.</returns>
+        public static OhlcvData ReadBinary(string path)
+        {
+            using (FileStream fs = new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.Read, chunkSize_))
+            {
+                return ReadBinary(fs);
+            }
+        }
+
+        /// <summary>
+        /// Reads data in the binary format written by WriteBinary. This is an eight
+        /// byte tag, a version number and the number of bars, followed by the dates
+        /// as 64 bit ticks and then the open, high, low, close and volume values as
+        /// 64 bit doubles, one column after another. All values are little endian.
+        /// </summary>
+        /// <param name="stream">The stream to read from.</param>
+        /// <returns>The data read.</returns>
+        public static OhlcvData ReadBinary(Stream stream)
+        {
+            BinaryReader r = new BinaryReader(stream);
+
+            if (Encoding.ASCII.GetString(r.ReadBytes(magic_.Length)) != magic_)
+                throw new NPlotException("Stream does not contain NPlot OHLCV data.");
+            int version = r.ReadInt32();
+            if (version != version_)
+                throw new NPlotException("Unsupported OHLCV data version: " + version);
+            int count = r.ReadInt32();
+            if (count < 0)
+                throw new NPlotException("Invalid OHLCV data.");
+
+            double[][] data = new double[ColumnNames.Length][];
+            byte[] chunk = new byte[chunkSize_];
+
+            long[] ticks = new long[count];
+            ReadColumn(stream, chunk, ticks, count);
+            data[0] = new double[count];
+            for (int i = 0; i < count; ++i)
+            {
+                data[0][i] = ticks[i];
+            }
+
+            for (int c = 1; c < data.Length; ++c)
+            {
+                data[c] = new double[count];
+                ReadColumn(stream, chunk, data[c], count);
+            }
+
+            return new OhlcvData(data[0], data[1], data[2], data[3], data[4], data[5]);
+        }
+
+        /// <summary>
+        /// Writes the data in the binary format to a file. See ReadBinary(Stream).
+        /// </summary>
+        /// <param name="path">The path of the file to write.</param>
+        public void WriteBinary(string path)
+        {
+            using (FileStream fs = new FileStream(path, FileMode.Create, FileAccess.Write, FileShare.None, chunkSize_))
+            {
+                WriteBinary(fs);
+            }
+        }
+
+        /// <summary>
+        /// Writes the data in the binary format. See ReadBinary(Stream).
+        /// </summary>
+        /// <param name="stream">The stream to write to.</param>
+        public void WriteBinary(Stream stream)
+        {
+            BinaryWriter w = new BinaryWriter(stream);
+            w.Write(Encoding.ASCII.GetBytes(magic_));
+            w.Write(version_);
+            w.Write(Count);
+
+            for (int i = 0; i < Count; ++i)
+            {
+                w.Write((long) Date[i]);
+            }
+
+            for (int c = 1; c < columns_.Length; ++c)
+            {
+                double[] values = columns_[c].Data;
+                for (int i = 0; i < values.Length; ++i)
+                {
+                    w.Write(values[i]);
+                }
+            }
+
+            w.Flush();
+        }
+
+        // Reads count 8 byte little endian values into an array of long or double.
+        private static void ReadColumn(Stream stream, byte[] chunk, Array values, int count)
+        {
+            long total = (long) count*8;
+            if (total > int.MaxValue)
+                throw new NPlotException("OHLCV data has too many rows to load: " + count);
+
+            long done = 0;
+            while (done < total)
+            {
+                int wanted = (int) Math.Min(chunk.Length, total - done);
+                int got = 0;
+                while (got < wanted)
+                {
+                    int read = stream.Read(chunk, got, wanted - got);
+                    if (read == 0)
+                        throw new NPlotException("OHLCV data is truncated.");
+                    got += read;
+                }
+
+                if (BitConverter.IsLittleEndian)
+                {
+                    Buffer.BlockCopy(chunk, 0, values, (int) done, got);
+                }
+                else
+                {
+                    for (int i = 0; i < got; i += 8)
+                    {
+                        Array.Reverse(chunk, i, 8);
+                        if (values is double[])
+                            ((double[]) values)[(done + i)/8] = BitConverter.ToDouble(chunk, i);
+                        else
+                            ((long[]) values)[(done + i)/8] = BitConverter.ToInt64(chunk, i);
+                    }
+                }
+
+                done += got;
+            }
+        }
+
+        #endregion
+
+        private static int IndexOf(string columnName)
+        {
+            for (int i = 0; i < ColumnNames.Length; ++i)
+            {
+                if (string.Compare(ColumnNames[i], columnName, true, CultureInfo.InvariantCulture) == 0)
+                    return i;
+            }
+            return -1;
+        }
+
+        /// <summary>
+        /// Accumulates rows into growable column arrays.
+        /// </summary>
+        private class Builder
+        {
+            private double[][] columns_ = new double[ColumnNames.Length][];
+            private int count_;
+
+            public Builder()
+            {
+                for (int i = 0; i < columns_.Length; ++i)
+                {
+                    columns_[i] = new double[1024];
+                }
+            }
+
+            public void BeginRow()
+            {
+                if (count_ == columns_[0].Length)
+                {
+                    for (int i = 0; i < columns_.Length; ++i)
+                    {
+                        double[] bigger = new double[count_*2];
+                        Array.Copy(columns_[i], bigger, count_);
+                        columns_[i] = bigger;
+                    }
+                }
+
+                for (int i = 0; i < columns_.Length; ++i)
+                {
+                    columns_[i][count_] = double.NaN;
+                }
+                ++count_;
+            }
+
+            public void Set(int column, double value)
+            {
+                columns_[column][count_ - 1] = value;
+            }
+
+            public OhlcvData ToData()
+            {
+                double[][] data = new double[columns_.Length][];
+                for (int i = 0; i < columns_.Length; ++i)
+                {
+                    data[i] = new double[count_];
+                    Array.Copy(columns_[i], data[i], count_);
+                }
+                return new OhlcvData(data[0], data[1], data[2], data[3], data[4], data[5]);
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -80,6 +80,16 @@ namespace NPlot
         /// </summary>
         public Point PhysicalMax { get; set; }
 
+        /// <summary>
+        /// If true, drawables draw against this axis the plain way, without the
+        /// optimizations that should not change what is drawn: WorldToPhysical on a
+        /// run of values transforms them one at a time with the exact transform, all
+        /// of the data is considered rather than just the visible slice, and nothing
+        /// is reused from the previous draw. Used for checking that the optimized
+        /// paths draw the same thing. See PlotSurface2D.ReferencePath.
+        /// </summary>
+        public bool ReferencePath { get; set; }
+
         /// <summary>
         /// The axis this object adds physical extents to.
         /// </summary>
@@ -139,6 +149,33 @@ namespace NPlot
             return Axis.WorldToPhysical(coord, PhysicalMin, PhysicalMax, clip);
         }
 
+        /// <summary>
+        /// Given a run of world coordinate values, finds the physical position of
+        /// each along the axis. Values are not clipped.
+        /// </summary>
+        /// <param name="coords">the world coordinates</param>
+        /// <param name="start">index in coords of the first value to transform.</param>
+        /// <param name="count">the number of values to transform.</param>
+        /// <param name="x">if not null, receives the physical x positions, starting at index 0.</param>
+        /// <param name="y">if not null, receives the physical y positions, starting at index 0.</param>
+        public void WorldToPhysical(double[] coords, int start, int count, float[] x, float[] y)
+        {
+            if (!ReferencePath)
+            {
+                Axis.WorldToPhysical(coords, start, count, PhysicalMin, PhysicalMax, x, y);
+                return;
+            }
+
+            for (int i = 0; i < count; ++i)
+            {
+                PointF p = Axis.WorldToPhysical(coords[start + i], PhysicalMin, PhysicalMax, false);
+                if (x != null)
+                    x[i] = p.X;
+                if (y != null)
+                    y[i] = p.Y;
+            }
+        }
+
         /// <summary>
         /// Given a physical point on the graphics surface, returns the world
         /// value of it's projection onto the axis [i.e. closest point on the axis].
@@ -32,6 +32,7 @@ using System;
 using System.Collections;
 using System.Drawing;
 using System.Drawing.Drawing2D;
+using System.Drawing.Imaging;
 
 namespace NPlot
 {
@@ -73,6 +74,13 @@ namespace NPlot
             Right = 3,
         }
 
+        /// <summary>
+        /// This is the signature of the function used for Rendered events.
+        /// </summary>
+        /// <param name="sender">the plot surface that was drawn.</param>
+        /// <param name="stats">where the time went while drawing it.</param>
+        public delegate void RenderedHandler(object sender, RenderStats stats);
+
         private readonly StringFormat titleDrawFormat_;
 
         private bool autoScaleAutoGeneratedAxes_;
@@ -93,11 +101,16 @@ namespace NPlot
         private PhysicalAxis pYAxis1Cache_;
         private PhysicalAxis pYAxis2Cache_;
         private int padding_;
+        private int previewDecimation_;
         private object plotAreaBoundingBoxCache_;
         private IRectangleBrush plotBackBrush_;
 
         private object plotBackColor_;
         private System.Drawing.Bitmap plotBackImage_;
+        private System.Drawing.Bitmap plotBackCache_;
+        private object plotBackCacheSource_;
+        private DrawQuality quality_;
+        private bool referencePath_;
         private SmoothingMode smoothingMode_;
         private Brush titleBrush_;
         private Font titleFont_;
@@ -106,9 +119,11 @@ namespace NPlot
         private Axis xAxis1_;
         private Axis xAxis2_;
         private ArrayList xAxisPositions_;
+        private ArrayList xAxisSuggestions_;
         private Axis yAxis1_;
         private Axis yAxis2_;
         private ArrayList yAxisPositions_;
+        private ArrayList yAxisSuggestions_;
         private ArrayList zPositions_;
 
         /// <summary>
@@ -173,6 +188,88 @@ namespace NPlot
             get { return pYAxis2Cache_; }
         }
 
+        /// <summary>
+        /// The layout worked out by a call to Draw, as needed by hit testing and
+        /// interactions: physical axis positions and bounding boxes.
+        /// </summary>
+        private class DrawnLayout
+        {
+            public object PlotArea;
+            public object Title;
+            public object XAxis1;
+            public object XAxis2;
+            public object YAxis1;
+            public object YAxis2;
+            public Point[] PhysicalMin;
+            public Point[] PhysicalMax;
+            public bool ReferencePath;
+        }
+
+        /// <summary>
+        /// Takes a copy of the layout of the last drawing, so that it can be put back
+        /// with RestoreLayout when an image of that drawing is shown again instead of
+        /// redrawing. Returns null if nothing has been drawn yet.
+        /// </summary>
+        internal object SaveLayout()
+        {
+            if (pXAxis1Cache_ == null || pYAxis1Cache_ == null || pXAxis2Cache_ == null || pYAxis2Cache_ == null)
+            {
+                return null;
+            }
+
+            DrawnLayout l = new DrawnLayout();
+            l.PlotArea = plotAreaBoundingBoxCache_;
+            l.Title = bbTitleCache_;
+            l.XAxis1 = bbXAxis1Cache_;
+            l.XAxis2 = bbXAxis2Cache_;
+            l.YAxis1 = bbYAxis1Cache_;
+            l.YAxis2 = bbYAxis2Cache_;
+            l.PhysicalMin = new Point[] {
+                pXAxis1Cache_.PhysicalMin, pXAxis2Cache_.PhysicalMin,
+                pYAxis1Cache_.PhysicalMin, pYAxis2Cache_.PhysicalMin };
+            l.PhysicalMax = new Point[] {
+                pXAxis1Cache_.PhysicalMax, pXAxis2Cache_.PhysicalMax,
+                pYAxis1Cache_.PhysicalMax, pYAxis2Cache_.PhysicalMax };
+            l.ReferencePath = pXAxis1Cache_.ReferencePath;
+            return l;
+        }
+
+        /// <summary>
+        /// Puts back a layout taken by SaveLayout. The physical axes are rebuilt
+        /// around the current axes, which should be those the layout was drawn with.
+        /// </summary>
+        /// <param name="layout">The layout returned by SaveLayout.</param>
+        internal void RestoreLayout(object layout)
+        {
+            DrawnLayout l = layout as DrawnLayout;
+            if (l == null)
+            {
+                return;
+            }
+
+            Axis xAxis1 = null;
+            Axis xAxis2 = null;
+            Axis yAxis1 = null;
+            Axis yAxis2 = null;
+            DetermineAxesToDraw(out xAxis1, out xAxis2, out yAxis1, out yAxis2);
+
+            pXAxis1Cache_ = new PhysicalAxis(xAxis1, l.PhysicalMin[0], l.PhysicalMax[0]);
+            pXAxis2Cache_ = new PhysicalAxis(xAxis2, l.PhysicalMin[1], l.PhysicalMax[1]);
+            pYAxis1Cache_ = new PhysicalAxis(yAxis1, l.PhysicalMin[2], l.PhysicalMax[2]);
+            pYAxis2Cache_ = new PhysicalAxis(yAxis2, l.PhysicalMin[3], l.PhysicalMax[3]);
+            pXAxis1Cache_.ReferencePath = l.ReferencePath;
+            pXAxis2Cache_.ReferencePath = l.ReferencePath;
+            pYAxis1Cache_.ReferencePath = l.ReferencePath;
+            pYAxis2Cache_.ReferencePath = l.ReferencePath;
+
+            plotAreaBoundingBoxCache_ = l.PlotArea;
+            bbTitleCache_ = l.Title;
+            bbXAxis1Cache_ = l.XAxis1;
+            bbXAxis2Cache_ = l.XAxis2;
+            bbYAxis1Cache_ = l.YAxis1;
+            bbYAxis2Cache_ = l.YAxis2;
+        }
+
         /// <summary>
         /// The bottom abscissa axis.
         /// </summary>
@@ -254,6 +351,84 @@ namespace NPlot
             set { titleBrush_ = value; }
         }
 
+        /// <summary>
+        /// Gets the plot background drawn with PlotBackImage or PlotBackBrush at the
+        /// given size. It is kept, and only drawn again when the size or the image or
+        /// brush changes, so a gradient or tiled background costs a single DrawImage
+        /// per frame.
+        /// </summary>
+        /// <param name="size">the size of the plot area.</param>
+        /// <returns>the background.</returns>
+        private System.Drawing.Bitmap PlotBackground(Size size)
+        {
+            object source = plotBackImage_ != null ? (object) plotBackImage_ : plotBackBrush_;
+            if (plotBackCache_ != null && plotBackCacheSource_ == source && plotBackCache_.Size == size)
+            {
+                return plotBackCache_;
+            }
+
+            InvalidatePlotBackground();
+
+            if (plotBackImage_ != null)
+            {
+                plotBackCache_ = Utils.TiledImage(plotBackImage_, size);
+            }
+            else
+            {
+                plotBackCache_ = new System.Drawing.Bitmap(size.Width, size.Height, PixelFormat.Format32bppPArgb);
+                using (Graphics g = Graphics.FromImage(plotBackCache_))
+                {
+                    DrawPlotBackground(g, new Rectangle(0, 0, size.Width, size.Height));
+                }
+            }
+            plotBackCacheSource_ = source;
+
+            return plotBackCache_;
+        }
+
+        /// <summary>
+        /// Draws the plot background of PlotBackImage or PlotBackBrush straight onto
+        /// an area of a surface, as is done when it is not kept.
+        /// </summary>
+        /// <param name="g">the surface to draw on.</param>
+        /// <param name="area">the area to fill.</param>
+        private void DrawPlotBackground(Graphics g, Rectangle area)
+        {
+            if (plotBackImage_ != null)
+            {
+                using (System.Drawing.Bitmap tiled = Utils.TiledImage(plotBackImage_, area.Size))
+                {
+                    g.DrawImage(tiled, area);
+                }
+            }
+            else
+            {
+                // only dispose the brush if it is known to have been made for this call.
+                Brush b = plotBackBrush_.Get(area);
+                g.FillRectangle(b, area);
+                if (RectangleBrushes.MakesNewBrush(plotBackBrush_))
+                {
+                    b.Dispose();
+                }
+            }
+        }
+
+        /// <summary>
+        /// Discards the kept plot background, so that it is drawn again on the next
+        /// draw. This is done automatically when the plot area changes size or a
+        /// background property is set, but is needed if the PlotBackImage bitmap is
+        /// modified in place.
+        /// </summary>
+        public void InvalidatePlotBackground()
+        {
+            if (plotBackCache_ != null)
+            {
+                plotBackCache_.Dispose();
+                plotBackCache_ = null;
+            }
+            plotBackCacheSource_ = null;
+        }
+
         /// <summary>
         /// A color used to paint the plot background. Mutually exclusive with PlotBackImage and PlotBackBrush
         /// </summary>
@@ -264,6 +439,7 @@ namespace NPlot
                 plotBackColor_ = value;
                 plotBackBrush_ = null;
                 plotBackImage_ = null;
+                InvalidatePlotBackground();
             }
         }
 
@@ -277,6 +453,7 @@ namespace NPlot
                 plotBackImage_ = value;
                 plotBackColor_ = null;
                 plotBackBrush_ = null;
+                InvalidatePlotBackground();
             }
         }
 
@@ -290,6 +467,7 @@ namespace NPlot
                 plotBackBrush_ = value;
                 plotBackColor_ = null;
                 plotBackImage_ = null;
+                InvalidatePlotBackground();
             }
         }
 
@@ -302,6 +480,48 @@ namespace NPlot
             set { smoothingMode_ = value; }
         }
 
+        /// <summary>
+        /// How much effort to put into drawing. Interactive surfaces use
+        /// DrawQuality.Preview while the user is dragging or zooming.
+        /// </summary>
+        public DrawQuality Quality
+        {
+            get { return quality_; }
+            set { quality_ = value; }
+        }
+
+        /// <summary>
+        /// The size in pixels of the detail that drawables may leave out
+        /// when Quality is DrawQuality.Preview.
+        /// </summary>
+        public int PreviewDecimation
+        {
+            get { return previewDecimation_; }
+            set { previewDecimation_ = value; }
+        }
+
+        /// <summary>
+        /// If true, the surface is drawn without the optimizations that should not
+        /// change what is drawn. This is slower, and is there to check those
+        /// optimizations against. Drawables transform their data one value at a time
+        /// with the exact transform of each axis rather than with the bulk transforms,
+        /// and consider all of their data rather than the visible slice. Axes
+        /// suggested by plots, the legend layout, the plot background and the heights
+        /// of stacked histograms are worked out again rather than kept, and bars are
+        /// filled with a brush made for each rather than one fitted brush.
+        /// </summary>
+        /// <remarks>
+        /// Set this before adding plots, so that their axes are suggested again
+        /// whenever the axes are updated. Unlike the other properties it is not
+        /// reset by Clear. Optimizations that change what is drawn on purpose have
+        /// their own switches: Quality, and CandlePlot.MinCandleSpacing.
+        /// </remarks>
+        public bool ReferencePath
+        {
+            get { return referencePath_; }
+            set { referencePath_ = value; }
+        }
+
         /// <summary>
         /// Adds a drawable object to the plot surface with z-order 0. If the object is an IPlot,
         /// the PlotSurface2D axes will also be updated.
@@ -349,6 +569,8 @@ namespace NPlot
             drawables_.Add(p);
             xAxisPositions_.Add(xp);
             yAxisPositions_.Add(yp);
+            xAxisSuggestions_.Add(null);
+            yAxisSuggestions_.Add(null);
             zPositions_.Add((double) zOrder);
             // fraction is to make key unique. With 10 million plots at same z, this buggers up.. 
             double fraction = (double) (++uniqueCounter_)/10000000.0f;
@@ -417,6 +639,11 @@ namespace NPlot
         /// Remove a drawable object.
         /// Note that axes are not updated.
         /// </summary>
+        /// <remarks>
+        /// The axes suggested by each plot are remembered from when it was added,
+        /// so updating the axes doesn't need to look at any data again. If the
+        /// data of a plot has changed since it was added, remove and add it again.
+        /// </remarks>
         /// <param name="p">Drawable to remove.</param>
         /// <param name="updateAxes">if true, the axes are updated.</param>
         public void Remove(IDrawable p, bool updateAxes)
@@ -427,6 +654,8 @@ namespace NPlot
             drawables_.RemoveAt(index);
             xAxisPositions_.RemoveAt(index);
             yAxisPositions_.RemoveAt(index);
+            xAxisSuggestions_.RemoveAt(index);
+            yAxisSuggestions_.RemoveAt(index);
             zPositions_.RemoveAt(index);
 
             if (updateAxes)
@@ -504,11 +733,52 @@ namespace NPlot
             return a;
         }
 
+        /// <summary>
+        /// Finds the data point drawn nearest to a physical position, considering
+        /// all sequence plots on the surface as they were last drawn.
+        /// </summary>
+        /// <param name="p">The physical position.</param>
+        /// <param name="radius">Only points within this physical distance of p are considered.</param>
+        /// <param name="plot">The plot containing the point found, or null if there is none.</param>
+        /// <param name="index">The index of the point found within the plot's data, or -1 if there is none.</param>
+        /// <returns>true if a point was found.</returns>
+        public bool NearestPoint(Point p, int radius, out BaseSequencePlot plot, out int index)
+        {
+            plot = null;
+            index = -1;
+            double best = Double.MaxValue;
+
+            for (int i = 0; i < drawables_.Count; ++i)
+            {
+                BaseSequencePlot sp = drawables_[i] as BaseSequencePlot;
+                if (sp == null)
+                    continue;
+
+                PhysicalAxis xAxis = (XAxisPosition) xAxisPositions_[i] == XAxisPosition.Bottom ? pXAxis1Cache_ : pXAxis2Cache_;
+                PhysicalAxis yAxis = (YAxisPosition) yAxisPositions_[i] == YAxisPosition.Left ? pYAxis1Cache_ : pYAxis2Cache_;
+                if (xAxis == null || yAxis == null)
+                    continue;
+
+                double distance;
+                int found = sp.PointIndex.Nearest(xAxis, yAxis, p, radius, out distance);
+                if (found >= 0 && distance < best)
+                {
+                    best = distance;
+                    plot = sp;
+                    index = found;
+                }
+            }
+
+            return plot != null;
+        }
+
         private void Init()
         {
             drawables_ = new ArrayList();
             xAxisPositions_ = new ArrayList();
             yAxisPositions_ = new ArrayList();
+            xAxisSuggestions_ = new ArrayList();
+            yAxisSuggestions_ = new ArrayList();
             zPositions_ = new ArrayList();
             ordering_ = new SortedList();
             FontFamily fontFamily = new FontFamily("Arial");
@@ -527,10 +797,13 @@ namespace NPlot
             pYAxis2Cache_ = null;
             titleBrush_ = new SolidBrush(Color.Black);
             plotBackColor_ = Color.White;
+            InvalidatePlotBackground();
 
             legend_ = null;
 
             smoothingMode_ = SmoothingMode.None;
+            quality_ = DrawQuality.Full;
+            previewDecimation_ = 2;
 
             axesConstraints_ = new ArrayList();
         }
@@ -550,9 +823,52 @@ namespace NPlot
             }
         }
 
+        /// <summary>
+        /// The x axis suggested by the i'th drawable, which must be an IPlot. The
+        /// suggestion is only asked for once, as it generally involves a pass through
+        /// all of the plot's data, unless drawing by the reference path. The returned
+        /// axis must not be modified.
+        /// </summary>
+        private Axis SuggestedXAxis(int i)
+        {
+            if (xAxisSuggestions_[i] == null || referencePath_)
+            {
+                xAxisSuggestions_[i] = ((IPlot) drawables_[i]).SuggestXAxis();
+            }
+            return (Axis) xAxisSuggestions_[i];
+        }
+
+        /// <summary>
+        /// The y axis suggested by the i'th drawable, which must be an IPlot. The
+        /// suggestion is only asked for once, as it generally involves a pass through
+        /// all of the plot's data, unless drawing by the reference path. The returned
+        /// axis must not be modified.
+        /// </summary>
+        private Axis SuggestedYAxis(int i)
+        {
+            if (yAxisSuggestions_[i] == null || referencePath_)
+            {
+                yAxisSuggestions_[i] = ((IPlot) drawables_[i]).SuggestYAxis();
+            }
+            return (Axis) yAxisSuggestions_[i];
+        }
+
+        /// <summary>
+        /// Returns a copy of a suggested axis that is free to be modified, or null.
+        /// </summary>
+        private static Axis CopyOfSuggestion(Axis a)
+        {
+            if (a == null)
+            {
+                return null;
+            }
+            return (Axis) a.Clone();
+        }
+
         private void UpdateAxes(bool recalculateAll)
         {
-            if (drawables_.Count != xAxisPositions_.Count || drawables_.Count != yAxisPositions_.Count)
+            if (drawables_.Count != xAxisPositions_.Count || drawables_.Count != yAxisPositions_.Count ||
+                drawables_.Count != xAxisSuggestions_.Count || drawables_.Count != yAxisSuggestions_.Count)
             {
                 throw new NPlotException("plots and axis position arrays our of sync");
             }
@@ -578,18 +894,17 @@ namespace NPlot
             for (int i = position; i < drawables_.Count; ++i)
             {
                 // only update axes if this drawable is an IPlot.
-                if (!(drawables_[position] is IPlot))
+                if (!(drawables_[i] is IPlot))
                     continue;
 
-                IPlot p = (IPlot) drawables_[position];
-                XAxisPosition xap = (XAxisPosition) xAxisPositions_[position];
-                YAxisPosition yap = (YAxisPosition) yAxisPositions_[position];
+                XAxisPosition xap = (XAxisPosition) xAxisPositions_[i];
+                YAxisPosition yap = (YAxisPosition) yAxisPositions_[i];
 
                 if (xap == XAxisPosition.Bottom)
                 {
                     if (xAxis1_ == null)
                     {
-                        xAxis1_ = p.SuggestXAxis();
+                        xAxis1_ = CopyOfSuggestion(SuggestedXAxis(i));
                         if (xAxis1_ != null)
                         {
                             xAxis1_.TicksAngle = -(float) Math.PI/2.0f;
@@ -597,7 +912,7 @@ namespace NPlot
                     }
                     else
                     {
-                        xAxis1_.LUB(p.SuggestXAxis());
+                        xAxis1_.LUB(SuggestedXAxis(i));
                     }
 
                     if (xAxis1_ != null)
@@ -623,7 +938,7 @@ namespace NPlot
                 {
                     if (xAxis2_ == null)
                     {
-                        xAxis2_ = p.SuggestXAxis();
+                        xAxis2_ = CopyOfSuggestion(SuggestedXAxis(i));
                         if (xAxis2_ != null)
                         {
                             xAxis2_.TicksAngle = (float) Math.PI/2.0f;
@@ -631,7 +946,7 @@ namespace NPlot
                     }
                     else
                     {
-                        xAxis2_.LUB(p.SuggestXAxis());
+                        xAxis2_.LUB(SuggestedXAxis(i));
                     }
 
                     if (xAxis2_ != null)
@@ -657,7 +972,7 @@ namespace NPlot
                 {
                     if (yAxis1_ == null)
                     {
-                        yAxis1_ = p.SuggestYAxis();
+                        yAxis1_ = CopyOfSuggestion(SuggestedYAxis(i));
                         if (yAxis1_ != null)
                         {
                             yAxis1_.TicksAngle = (float) Math.PI/2.0f;
@@ -665,7 +980,7 @@ namespace NPlot
                     }
                     else
                     {
-                        yAxis1_.LUB(p.SuggestYAxis());
+                        yAxis1_.LUB(SuggestedYAxis(i));
                     }
 
                     if (yAxis1_ != null)
@@ -689,7 +1004,7 @@ namespace NPlot
                 {
                     if (yAxis2_ == null)
                     {
-                        yAxis2_ = p.SuggestYAxis();
+                        yAxis2_ = CopyOfSuggestion(SuggestedYAxis(i));
                         if (yAxis2_ != null)
                         {
                             yAxis2_.TicksAngle = -(float) Math.PI/2.0f;
@@ -697,7 +1012,7 @@ namespace NPlot
                     }
                     else
                     {
-                        yAxis2_.LUB(p.SuggestYAxis());
+                        yAxis2_.LUB(SuggestedYAxis(i));
                     }
 
                     if (yAxis2_ != null)
@@ -860,6 +1175,13 @@ namespace NPlot
             pYAxis2.PhysicalMax = new Point(cb.Right - rightIndent, cb.Top + topIndent);
         }
 
+        /// <summary>
+        /// Raised after each call to Draw, with the time taken by each phase of the
+        /// draw. Timings are only recorded while there is a handler attached (or the
+        /// RenderStats trace source is on), so this costs nothing otherwise.
+        /// </summary>
+        public event RenderedHandler Rendered;
+
         /// <summary>
         /// Draw the the PlotSurface2D and all contents [axes, drawables, and legend] on the
         /// supplied graphics surface.
@@ -870,6 +1192,26 @@ namespace NPlot
         /// surface to confine drawing to.
         /// </param>
         public void Draw(Graphics g, Rectangle bounds)
+        {
+            if (Rendered == null && !RenderStats.Tracing)
+            {
+                Draw(g, bounds, null);
+                return;
+            }
+
+            RenderStats stats = new RenderStats();
+            Draw(g, bounds, stats);
+            stats.Stop();
+            if (Rendered != null)
+            {
+                Rendered(this, stats);
+            }
+        }
+
+        /// <summary>
+        /// Draw, recording where the time goes in stats if it is not null.
+        /// </summary>
+        private void Draw(Graphics g, Rectangle bounds, RenderStats stats)
         {
             // determine font sizes and tick scale factor.
             float scale = DetermineScaleFactor(bounds.Width, bounds.Height);
@@ -891,6 +1233,8 @@ namespace NPlot
                 }
                 g.DrawString(title_, scaled_font, titleBrush_, new PointF(x_center, y_center), titleDrawFormat_);
 
+                if (stats != null)
+                    stats.EndTitle();
                 return;
             }
 
@@ -929,6 +1273,11 @@ namespace NPlot
                 bounds, xAxis1, xAxis2, yAxis1, yAxis2,
                 out pXAxis1, out pXAxis2, out pYAxis1, out pYAxis2);
 
+            pXAxis1.ReferencePath = referencePath_;
+            pYAxis1.ReferencePath = referencePath_;
+            pXAxis2.ReferencePath = referencePath_;
+            pYAxis2.ReferencePath = referencePath_;
+
             float oldXAxis2Height = pXAxis2.PhysicalMin.Y;
 
             // Apply axes constraints
@@ -945,6 +1294,10 @@ namespace NPlot
             Point legendPosition = new Point(0, 0);
             if (legend_ != null)
             {
+                if (referencePath_)
+                {
+                    legend_.InvalidateLayout();
+                }
                 legend_.UpdateAxesPositions(
                     pXAxis1, pYAxis1, pXAxis2, pYAxis2,
                     drawables_, scale, padding_, bounds,
@@ -968,28 +1321,38 @@ namespace NPlot
             bbYAxis1Cache_ = pYAxis1.GetBoundingBox();
             bbYAxis2Cache_ = pYAxis2.GetBoundingBox();
 
+            if (stats != null)
+                stats.EndLayout();
+
             // Fill in the background. 
+            Rectangle plotArea = (Rectangle) plotAreaBoundingBoxCache_;
             if (plotBackColor_ != null)
             {
-                g.FillRectangle(
-                    new SolidBrush((Color) plotBackColor_),
-                    (Rectangle) plotAreaBoundingBoxCache_);
+                using (Brush b = new SolidBrush((Color) plotBackColor_))
+                {
+                    g.FillRectangle(b, plotArea);
+                }
             }
-            else if (plotBackBrush_ != null)
+            else if (plotBackBrush_ is RectangleBrushes.Solid)
             {
-                g.FillRectangle(
-                    plotBackBrush_.Get((Rectangle) plotAreaBoundingBoxCache_),
-                    (Rectangle) plotAreaBoundingBoxCache_);
+                g.FillRectangle(plotBackBrush_.Get(plotArea), plotArea);
             }
-            else if (plotBackImage_ != null)
+            else if ((plotBackBrush_ != null || plotBackImage_ != null) &&
+                     plotArea.Width > 0 && plotArea.Height > 0)
             {
-                g.DrawImage(
-                    Utils.TiledImage(plotBackImage_, new Size(
-                                                         ((Rectangle) plotAreaBoundingBoxCache_).Width,
-                                                         ((Rectangle) plotAreaBoundingBoxCache_).Height)),
-                    (Rectangle) plotAreaBoundingBoxCache_);
+                if (referencePath_)
+                {
+                    DrawPlotBackground(g, plotArea);
+                }
+                else
+                {
+                    g.DrawImage(PlotBackground(plotArea.Size), plotArea);
+                }
             }
 
+            if (stats != null)
+                stats.EndBackground();
+
             // draw title
             float xt = (pXAxis2.PhysicalMax.X + pXAxis2.PhysicalMin.X)/2.0f;
             float yt = bounds.Top + padding_ - titleExtraOffset;
@@ -1015,10 +1378,20 @@ namespace NPlot
             SizeF s = g.MeasureString(title_, scaledFont);
             bbTitleCache_ = new Rectangle((int) (xt - s.Width/2), (int) (yt), (int) (s.Width), (int) (s.Height)*(nlCount + 1));
 
+            if (stats != null)
+                stats.EndTitle();
+
             // draw drawables..
             SmoothingMode smoothSave = g.SmoothingMode;
 
-            g.SmoothingMode = smoothingMode_;
+            if (quality_ == DrawQuality.Preview)
+            {
+                g.SmoothingMode = SmoothingMode.None;
+            }
+            else
+            {
+                g.SmoothingMode = smoothingMode_;
+            }
 
             bool legendDrawn = false;
 
@@ -1033,6 +1406,8 @@ namespace NPlot
                     {
                         legend_.Draw(g, legendPosition, drawables_, scale);
                         legendDrawn = true;
+                        if (stats != null)
+                            stats.EndLegend();
                     }
                 }
 
@@ -1064,14 +1439,26 @@ namespace NPlot
                 // set the clipping region.. (necessary for zoom)
                 g.Clip = new Region((Rectangle) plotAreaBoundingBoxCache_);
                 // plot.
-                drawable.Draw(g, drawXAxis, drawYAxis);
+                if (quality_ == DrawQuality.Preview && drawable is IPreviewDrawable)
+                {
+                    ((IPreviewDrawable) drawable).DrawPreview(g, drawXAxis, drawYAxis, previewDecimation_);
+                }
+                else
+                {
+                    drawable.Draw(g, drawXAxis, drawYAxis);
+                }
                 // reset it..
                 g.ResetClip();
+
+                if (stats != null)
+                    stats.EndDrawable(drawable);
             }
 
             if (!legendDrawn && legend_ != null)
             {
                 legend_.Draw(g, legendPosition, drawables_, scale);
+                if (stats != null)
+                    stats.EndLegend();
             }
 
             // cache the physical axes we used on this draw;
@@ -1089,6 +1476,9 @@ namespace NPlot
             pYAxis1.Draw(g, out axisBounds);
             pYAxis2.Draw(g, out axisBounds);
 
+            if (stats != null)
+                stats.EndAxes();
+
 #if DEBUG_BOUNDING_BOXES
 			g.DrawRectangle( new Pen(Color.Orange), (Rectangle) bbXAxis1Cache_ );
 			g.DrawRectangle( new Pen(Color.Orange), (Rectangle) bbXAxis2Cache_ );
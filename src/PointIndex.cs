@@ -0,0 +1,267 @@
+/*
+ * NPlot - A charting library for .NET
+ * 
+ * PointIndex.cs
+ * Copyright (C) 2003-2006 Matt Howlett and others.
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+using System;
+using System.Drawing;
+
+namespace NPlot
+{
+    /// <summary>
+    /// A spatial index over the points of a sequence, for finding the data point
+    /// nearest to a physical position (such as the mouse cursor) without looking
+    /// at every point.
+    /// </summary>
+    /// <remarks>
+    /// The data is read through the SequenceAdapter, not copied. If the abscissa
+    /// values are known to be in ascending order the points near the position are
+    /// found by binary search on them. Otherwise the points in view are bucketed
+    /// into a uniform grid over the visible world region, with about four points
+    /// per cell for evenly spread data, and the grid is rebuilt when the view
+    /// changes. Either way a query only considers the points within the search
+    /// radius of the position, plus a few around them.
+    /// </remarks>
+    public class PointIndex
+    {
+        private readonly SequenceAdapter data_;
+
+        // grid, used when the abscissa values are not sorted. The points of
+        // cell c are cellPoints_[cellStart_[c]] .. cellPoints_[cellStart_[c+1]-1].
+        private int cellsX_;
+        private int cellsY_;
+        private double gridMinX_;
+        private double gridMinY_;
+        private double gridMaxX_;
+        private double gridMaxY_;
+        private double cellWidth_;
+        private double cellHeight_;
+        private int[] cellStart_;
+        private int[] cellPoints_;
+
+        /// <summary>
+        /// Constructor
+        /// </summary>
+        /// <param name="data">the sequence to index.</param>
+        public PointIndex(SequenceAdapter data)
+        {
+            data_ = data;
+        }
+
+        /// <summary>
+        /// The number of points in the index.
+        /// </summary>
+        public int Count
+        {
+            get { return data_.Count; }
+        }
+
+        /// <summary>
+        /// The world coordinates of the ith point.
+        /// </summary>
+        public PointD this[int i]
+        {
+            get { return data_[i]; }
+        }
+
+        /// <summary>
+        /// Builds the grid over the points inside the given world region, unless
+        /// it is already built over that region.
+        /// </summary>
+        private void BuildGrid(double minX, double maxX, double minY, double maxY)
+        {
+            if (cellStart_ != null && minX == gridMinX_ && maxX == gridMaxX_ && minY == gridMinY_ && maxY == gridMaxY_)
+                return;
+
+            gridMinX_ = minX;
+            gridMaxX_ = maxX;
+            gridMinY_ = minY;
+            gridMaxY_ = maxY;
+
+            int count = data_.Count;
+            int visible = 0;
+            for (int i = 0; i < count; ++i)
+            {
+                if (Inside(data_[i], minX, maxX, minY, maxY))
+                    ++visible;
+            }
+
+            int cells = Math.Max(1, (int) Math.Sqrt(visible/4.0));
+            cellsX_ = cells;
+            cellsY_ = cells;
+            cellStart_ = new int[cellsX_*cellsY_ + 1];
+            cellPoints_ = new int[visible];
+            cellWidth_ = maxX > minX ? (maxX - minX)/cellsX_ : 1.0;
+            cellHeight_ = maxY > minY ? (maxY - minY)/cellsY_ : 1.0;
+
+            if (visible == 0)
+                return;
+
+            // counting sort of the points into their cells.
+            int[] points = new int[visible];
+            int[] cellOf = new int[visible];
+            int n = 0;
+            for (int i = 0; i < count && n < visible; ++i)
+            {
+                PointD p = data_[i];
+                if (!Inside(p, minX, maxX, minY, maxY))
+                    continue;
+                points[n] = i;
+                cellOf[n] = CellY(p.Y)*cellsX_ + CellX(p.X);
+                cellStart_[cellOf[n] + 1] += 1;
+                ++n;
+            }
+            for (int c = 0; c < cellsX_*cellsY_; ++c)
+            {
+                cellStart_[c + 1] += cellStart_[c];
+            }
+            int[] fill = (int[]) cellStart_.Clone();
+            for (int j = 0; j < n; ++j)
+            {
+                cellPoints_[fill[cellOf[j]]++] = points[j];
+            }
+        }
+
+        /// <summary>
+        /// True if p is inside the world region. NaN values never are.
+        /// </summary>
+        private static bool Inside(PointD p, double minX, double maxX, double minY, double maxY)
+        {
+            return p.X >= minX && p.X <= maxX && p.Y >= minY && p.Y <= maxY;
+        }
+
+        private int CellX(double x)
+        {
+            int c = (int) ((x - gridMinX_)/cellWidth_);
+            return Math.Max(0, Math.Min(cellsX_ - 1, c));
+        }
+
+        private int CellY(double y)
+        {
+            int c = (int) ((y - gridMinY_)/cellHeight_);
+            return Math.Max(0, Math.Min(cellsY_ - 1, c));
+        }
+
+        /// <summary>
+        /// Finds the point nearest to a physical position, as drawn against the given axes.
+        /// </summary>
+        /// <param name="xAxis">the physical x axis the points are drawn against.</param>
+        /// <param name="yAxis">the physical y axis the points are drawn against.</param>
+        /// <param name="p">the physical position.</param>
+        /// <param name="radius">only points within this physical distance of p are considered.</param>
+        /// <param name="distance">the physical distance of the point found from p.</param>
+        /// <returns>the index of the point found, or -1 if there is no point within radius.</returns>
+        public int Nearest(PhysicalAxis xAxis, PhysicalAxis yAxis, Point p, int radius, out double distance)
+        {
+            distance = Double.MaxValue;
+            int nearest = -1;
+
+            if (data_.Count == 0)
+                return -1;
+
+            // the world region that is within radius of p. Only points inside it are
+            // transformed, so values a LogAxis can not show are never considered.
+            double x1 = xAxis.PhysicalToWorld(new Point(p.X - radius, p.Y + radius), false);
+            double x2 = xAxis.PhysicalToWorld(new Point(p.X + radius, p.Y - radius), false);
+            double y1 = yAxis.PhysicalToWorld(new Point(p.X - radius, p.Y + radius), false);
+            double y2 = yAxis.PhysicalToWorld(new Point(p.X + radius, p.Y - radius), false);
+            if (x1 > x2)
+                Utils.Swap(ref x1, ref x2);
+            if (y1 > y2)
+                Utils.Swap(ref y1, ref y2);
+
+            double best = (double) radius*radius;
+
+            if (data_.AbscissaSorted)
+            {
+                int first;
+                int last;
+                data_.GetIndexRange(x1, x2, out first, out last);
+                for (int i = first; i <= last; ++i)
+                {
+                    Consider(xAxis, yAxis, p, i, x1, x2, y1, y2, ref best, ref nearest);
+                }
+            }
+            else
+            {
+                double minX = xAxis.Axis.WorldMin;
+                double maxX = xAxis.Axis.WorldMax;
+                double minY = yAxis.Axis.WorldMin;
+                double maxY = yAxis.Axis.WorldMax;
+                if (minX > maxX)
+                    Utils.Swap(ref minX, ref maxX);
+                if (minY > maxY)
+                    Utils.Swap(ref minY, ref maxY);
+                BuildGrid(minX, maxX, minY, maxY);
+
+                if (cellPoints_.Length == 0)
+                    return -1;
+
+                if (x2 < gridMinX_ || y2 < gridMinY_ || x1 > gridMaxX_ || y1 > gridMaxY_)
+                    return -1;
+
+                int cx1 = CellX(x1);
+                int cx2 = CellX(x2);
+                int cy1 = CellY(y1);
+                int cy2 = CellY(y2);
+                for (int cy = cy1; cy <= cy2; ++cy)
+                {
+                    for (int cx = cx1; cx <= cx2; ++cx)
+                    {
+                        int c = cy*cellsX_ + cx;
+                        for (int j = cellStart_[c]; j < cellStart_[c + 1]; ++j)
+                        {
+                            Consider(xAxis, yAxis, p, cellPoints_[j], x1, x2, y1, y2, ref best, ref nearest);
+                        }
+                    }
+                }
+            }
+
+            if (nearest >= 0)
+            {
+                distance = Math.Sqrt(best);
+            }
+            return nearest;
+        }
+
+        private void Consider(PhysicalAxis xAxis, PhysicalAxis yAxis, Point p, int i,
+                              double x1, double x2, double y1, double y2, ref double best, ref int nearest)
+        {
+            PointD w = data_[i];
+            if (!Inside(w, x1, x2, y1, y2))
+                return;
+
+            double dx = xAxis.WorldToPhysical(w.X, false).X - p.X;
+            double dy = yAxis.WorldToPhysical(w.Y, false).Y - p.Y;
+            double d = dx*dx + dy*dy;
+            if (d <= best)
+            {
+                best = d;
+                nearest = i;
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -34,7 +34,7 @@ namespace NPlot
     /// <summary>
     /// Encapsulates functionality for drawing data as a series of points.
     /// </summary>
-    public class PointPlot : BaseSequencePlot, ISequencePlot, IPlot
+    public class PointPlot : BaseSequencePlot, ISequencePlot, IPlot, IPreviewDrawable
     {
         private Marker marker_;
 
@@ -71,28 +71,114 @@ namespace NPlot
         /// <param name="xAxis">The X-Axis to draw against.</param>
         /// <param name="yAxis">The Y-Axis to draw against.</param>
         public virtual void Draw(Graphics g, PhysicalAxis xAxis, PhysicalAxis yAxis)
+        {
+            DrawMarkers(g, xAxis, yAxis, 0);
+        }
+
+        /// <summary>
+        /// Draws a decimated version of the point plot, in which at most one marker
+        /// is drawn in each square of the given size.
+        /// </summary>
+        /// <param name="g">The GDI+ surface on which to draw.</param>
+        /// <param name="xAxis">The X-Axis to draw against.</param>
+        /// <param name="yAxis">The Y-Axis to draw against.</param>
+        /// <param name="decimation">The size in pixels of the squares.</param>
+        public virtual void DrawPreview(Graphics g, PhysicalAxis xAxis, PhysicalAxis yAxis, int decimation)
+        {
+            DrawMarkers(g, xAxis, yAxis, decimation);
+        }
+
+        /// <summary>
+        /// Draws the markers, at most one in each decimation sized square if decimation is
+        /// greater than zero.
+        /// </summary>
+        private void DrawMarkers(Graphics g, PhysicalAxis xAxis, PhysicalAxis yAxis, int decimation)
         {
             SequenceAdapter data_ =
-                new SequenceAdapter(DataSource, DataMember, OrdinateData, AbscissaData);
+                new SequenceAdapter(DataSource, DataMember, OrdinateData, AbscissaData, AbscissaSorted);
 
             float leftCutoff_ = xAxis.PhysicalMin.X - marker_.Size;
             float rightCutoff_ = xAxis.PhysicalMax.X + marker_.Size;
 
-            for (int i = 0; i < data_.Count; ++i)
+            // only consider points near the visible range.
+            double worldLeft = xAxis.PhysicalToWorld(new Point((int) leftCutoff_, xAxis.PhysicalMin.Y), false);
+            double worldRight = xAxis.PhysicalToWorld(new Point((int) rightCutoff_, xAxis.PhysicalMax.Y), false);
+            if (worldLeft > worldRight)
             {
-                if (!Double.IsNaN(data_[i].X) && !Double.IsNaN(data_[i].Y))
+                Utils.Swap(ref worldLeft, ref worldRight);
+            }
+            int first = 0;
+            int last = data_.Count - 1;
+            if (!xAxis.ReferencePath)
+            {
+                data_.GetIndexRange(worldLeft, worldRight, out first, out last);
+            }
+
+            if (data_.Count == 0)
+            {
+                return;
+            }
+
+            // transform the whole run in one go.
+            int n = last - first + 1;
+            double[] worldX;
+            double[] worldY;
+            float[] physicalX;
+            float[] physicalY;
+            GetTransformBuffers(n, out worldX, out worldY, out physicalX, out physicalY);
+            data_.CopyTo(first, n, worldX, worldY);
+
+            xAxis.WorldToPhysical(worldX, 0, n, physicalX, null);
+            yAxis.WorldToPhysical(worldY, 0, n, null, physicalY);
+
+            float yStart = 0.0f;
+            if (marker_.DropLine)
+            {
+                yStart = yAxis.WorldToPhysical(Math.Max(0.0f, yAxis.Axis.WorldMin), false).Y;
+            }
+
+            // squares already holding a marker, when decimating.
+            bool[] occupied = null;
+            int columns = 0;
+            int rows = 0;
+            int originX = Math.Min(xAxis.PhysicalMin.X, xAxis.PhysicalMax.X);
+            int originY = Math.Min(yAxis.PhysicalMin.Y, yAxis.PhysicalMax.Y);
+            if (decimation > 0)
+            {
+                columns = Math.Abs(xAxis.PhysicalMax.X - xAxis.PhysicalMin.X)/decimation + 1;
+                rows = Math.Abs(yAxis.PhysicalMax.Y - yAxis.PhysicalMin.Y)/decimation + 1;
+                occupied = new bool[columns*rows];
+            }
+
+            for (int i = 0; i < n; ++i)
+            {
+                if (!Double.IsNaN(worldX[i]) && !Double.IsNaN(worldY[i]))
                 {
-                    PointF xPos = xAxis.WorldToPhysical(data_[i].X, false);
-                    if (xPos.X < leftCutoff_ || rightCutoff_ < xPos.X)
+                    float xPos = physicalX[i];
+                    if (xPos < leftCutoff_ || rightCutoff_ < xPos || Single.IsNaN(xPos))
+                        continue;
+
+                    // not transformable, eg. non-positive on a log axis.
+                    float yPos = physicalY[i];
+                    if (Single.IsNaN(yPos))
                         continue;
 
-                    PointF yPos = yAxis.WorldToPhysical(data_[i].Y, false);
-                    marker_.Draw(g, (int) xPos.X, (int) yPos.Y);
+                    if (occupied != null)
+                    {
+                        int column = (int) Math.Floor((xPos - originX)/decimation);
+                        int row = (int) Math.Floor((yPos - originY)/decimation);
+                        if (column >= 0 && column < columns && row >= 0 && row < rows)
+                        {
+                            if (occupied[row*columns + column])
+                                continue;
+                            occupied[row*columns + column] = true;
+                        }
+                    }
+
+                    marker_.Draw(g, (int) xPos, (int) yPos);
                     if (marker_.DropLine)
                     {
-                        PointD yMin = new PointD(data_[i].X, Math.Max(0.0f, yAxis.Axis.WorldMin));
-                        PointF yStart = yAxis.WorldToPhysical(yMin.Y, false);
-                        g.DrawLine(marker_.Pen, new Point((int) xPos.X, (int) yStart.Y), new Point((int) xPos.X, (int) yPos.Y));
+                        g.DrawLine(marker_.Pen, new Point((int) xPos, (int) yStart), new Point((int) xPos, (int) yPos));
                     }
                 }
             }
@@ -0,0 +1,157 @@
+/*
+ * NPlot - A charting library for .NET
+ * 
+ * RectangleBrushCache.cs
+ * Copyright (C) 2003-2006 Matt Howlett and others.
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+using System;
+using System.Drawing;
+using System.Drawing.Drawing2D;
+
+namespace NPlot
+{
+    /// <summary>
+    /// Wraps an IRectangleBrush so that filling many rectangles with it - the bars of
+    /// a BarPlot or HistogramPlot, say - doesn't create a native brush per rectangle.
+    /// A gradient brush is made once for a reference square, and fitted to each
+    /// rectangle asked for by setting its transform. The brush returned by Get must be
+    /// used before Get is called again.
+    /// </summary>
+    /// <remarks>
+    /// Brushes other than gradient brushes can't be fitted to a rectangle this way. A
+    /// SolidBrush is reused as it is, since it doesn't depend on the rectangle, and
+    /// for any other kind the wrapped IRectangleBrush is asked for each rectangle as
+    /// usual.
+    ///
+    /// The brush made for the reference square is owned by the cache. If it is kept it
+    /// is disposed by Dispose, and if not (a hatch or texture brush, say) it is disposed
+    /// straight away. This assumes that the wrapped IRectangleBrush returns a new brush
+    /// from each call to Get, as the gradient brushes of RectangleBrushes do. Solid is
+    /// never asked for a reference brush, as it keeps its own.
+    /// </remarks>
+    public class RectangleBrushCache : IRectangleBrush, IDisposable
+    {
+        /// <summary>
+        /// The size of the square the gradient brush is made for.
+        /// </summary>
+        private const int referenceSize_ = 256;
+
+        private readonly IRectangleBrush brush_;
+        private bool checked_;
+        private Brush reference_;
+        private bool fitted_;
+
+        /// <summary>
+        /// Constructor
+        /// </summary>
+        /// <param name="brush">the IRectangleBrush to make brushes with.</param>
+        public RectangleBrushCache(IRectangleBrush brush)
+        {
+            brush_ = brush;
+        }
+
+        /// <summary>
+        /// The IRectangleBrush brushes are made with.
+        /// </summary>
+        public IRectangleBrush Brush
+        {
+            get { return brush_; }
+        }
+
+        /// <summary>
+        /// Gets a brush according to the supplied rectangle.
+        /// </summary>
+        /// <param name="rectangle">the rectangle used to construct the brush</param>
+        /// <returns>The brush. Not to be disposed, and only valid until Get is next called.</returns>
+        public Brush Get(Rectangle rectangle)
+        {
+            if (!checked_)
+            {
+                checked_ = true;
+
+                // a Solid brush returns the same brush every time, so needs no help.
+                if (!(brush_ is RectangleBrushes.Solid))
+                {
+                    Brush reference = brush_.Get(new Rectangle(0, 0, referenceSize_, referenceSize_));
+                    if (reference is LinearGradientBrush || reference is PathGradientBrush || reference is SolidBrush)
+                    {
+                        reference_ = reference;
+                        fitted_ = !(reference is SolidBrush);
+                    }
+                    else if (reference != null)
+                    {
+                        reference.Dispose();
+                    }
+                }
+            }
+
+            if (reference_ == null)
+            {
+                return brush_.Get(rectangle);
+            }
+
+            if (!fitted_)
+            {
+                return reference_;
+            }
+
+            // map the reference square onto the rectangle. A zero size is left unscaled,
+            // as nothing is drawn in that direction anyway.
+            float sx = rectangle.Width != 0 ? (float) rectangle.Width/referenceSize_ : 1.0f;
+            float sy = rectangle.Height != 0 ? (float) rectangle.Height/referenceSize_ : 1.0f;
+
+            if (reference_ is LinearGradientBrush)
+            {
+                LinearGradientBrush b = (LinearGradientBrush) reference_;
+                b.ResetTransform();
+                b.TranslateTransform(rectangle.X, rectangle.Y);
+                b.ScaleTransform(sx, sy);
+            }
+            else
+            {
+                PathGradientBrush b = (PathGradientBrush) reference_;
+                b.ResetTransform();
+                b.TranslateTransform(rectangle.X, rectangle.Y);
+                b.ScaleTransform(sx, sy);
+            }
+
+            return reference_;
+        }
+
+        /// <summary>
+        /// Disposes the brush kept by the cache, if any.
+        /// </summary>
+        public void Dispose()
+        {
+            if (reference_ != null)
+            {
+                reference_.Dispose();
+            }
+            reference_ = null;
+            fitted_ = false;
+            checked_ = false;
+        }
+    }
+}
\ No newline at end of file
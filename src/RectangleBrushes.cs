@@ -35,6 +35,13 @@ namespace NPlot
     /// Classes that implement this interface can provide a brush
     /// sized according to a given rectangle.
     /// </summary>
+    /// <remarks>
+    /// The brush returned by Get is generally not disposed by NPlot, as it may be one
+    /// the implementation keeps and returns again. The exceptions are the gradient
+    /// brushes of RectangleBrushes, which make a new brush each time, and the single
+    /// reference brush a RectangleBrushCache asks for when filling the bars of a
+    /// BarPlot or HistogramPlot, which it owns.
+    /// </remarks>
     public interface IRectangleBrush
     {
         /// <summary>
@@ -50,6 +57,18 @@ namespace NPlot
     /// </summary>
     public class RectangleBrushes
     {
+        /// <summary>
+        /// Whether a brush is one of the gradient brushes here, whose Get makes a new
+        /// brush each time that the caller can dispose once it has been used.
+        /// </summary>
+        /// <param name="brush">the rectangle brush.</param>
+        /// <returns>true if Get returns a new brush.</returns>
+        internal static bool MakesNewBrush(IRectangleBrush brush)
+        {
+            return brush is Horizontal || brush is HorizontalCenterFade ||
+                   brush is Vertical || brush is VerticalCenterFade;
+        }
+
         /// <summary>
         /// A brush with horizontal gradient.
         /// </summary>
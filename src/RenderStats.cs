@@ -0,0 +1,234 @@
+/*
+ * NPlot - A charting library for .NET
+ * 
+ * RenderStats.cs
+ * Copyright (C) 2003-2006 Matt Howlett and others.
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+using System;
+using System.Collections;
+using System.Diagnostics;
+using System.Globalization;
+using System.Text;
+
+namespace NPlot
+{
+    /// <summary>
+    /// Where the time went when a PlotSurface2D was drawn: the time spent laying
+    /// out the axes and legend, filling the background, drawing the title, each
+    /// drawable, the legend and the axes. Also the number of bytes allocated
+    /// during the draw, where the runtime can report it.
+    /// </summary>
+    /// <remarks>
+    /// Stats are only recorded when something is listening, either a handler on
+    /// PlotSurface2D.Rendered or the TraceSource below switched to Verbose, so an
+    /// unobserved draw does not pay for them.
+    /// </remarks>
+    public class RenderStats
+    {
+        private static readonly TraceSource traceSource_ = new TraceSource("NPlot.Render", SourceLevels.Off);
+        private static bool allocationMonitoringUnsupported_;
+
+        private readonly long start_;
+        private readonly long startAllocated_;
+        private long mark_;
+        private ArrayList drawables_ = new ArrayList();
+        private ArrayList drawableTimes_ = new ArrayList();
+
+        /// <summary>
+        /// Starts the clock.
+        /// </summary>
+        internal RenderStats()
+        {
+            startAllocated_ = CurrentAllocatedBytes();
+            start_ = Stopwatch.GetTimestamp();
+            mark_ = start_;
+        }
+
+        /// <summary>
+        /// Render stats are written to this trace source, at the Verbose level, after
+        /// each draw. It is named "NPlot.Render" and is off by default. It can be switched
+        /// on in the application configuration file, so that render costs can be seen in
+        /// production without changing code or attaching a profiler.
+        /// </summary>
+        public static TraceSource TraceSource
+        {
+            get { return traceSource_; }
+        }
+
+        /// <summary>
+        /// Milliseconds spent determining the axes and positioning them and the legend.
+        /// </summary>
+        public double LayoutMilliseconds { get; private set; }
+
+        /// <summary>
+        /// Milliseconds spent filling the plot area background.
+        /// </summary>
+        public double BackgroundMilliseconds { get; private set; }
+
+        /// <summary>
+        /// Milliseconds spent drawing the title.
+        /// </summary>
+        public double TitleMilliseconds { get; private set; }
+
+        /// <summary>
+        /// Milliseconds spent drawing the legend.
+        /// </summary>
+        public double LegendMilliseconds { get; private set; }
+
+        /// <summary>
+        /// Milliseconds spent drawing the axes.
+        /// </summary>
+        public double AxesMilliseconds { get; private set; }
+
+        /// <summary>
+        /// Milliseconds for the whole draw.
+        /// </summary>
+        public double TotalMilliseconds { get; private set; }
+
+        /// <summary>
+        /// The drawables, in the order they were drawn.
+        /// </summary>
+        public IDrawable[] Drawables { get; private set; }
+
+        /// <summary>
+        /// Milliseconds spent drawing each of the Drawables, including setting up
+        /// its clipping region.
+        /// </summary>
+        public double[] DrawableMilliseconds { get; private set; }
+
+        /// <summary>
+        /// Bytes allocated during the draw, by all threads of the application domain.
+        /// -1 if the runtime can't report this: AppDomain.MonitoringIsEnabled needs to
+        /// be set to true by the application for it to be available.
+        /// </summary>
+        public long AllocatedBytes { get; private set; }
+
+        private double Lap()
+        {
+            long now = Stopwatch.GetTimestamp();
+            double ms = (now - mark_)*1000.0/Stopwatch.Frequency;
+            mark_ = now;
+            return ms;
+        }
+
+        internal void EndLayout()
+        {
+            LayoutMilliseconds += Lap();
+        }
+
+        internal void EndBackground()
+        {
+            BackgroundMilliseconds += Lap();
+        }
+
+        internal void EndTitle()
+        {
+            TitleMilliseconds += Lap();
+        }
+
+        internal void EndLegend()
+        {
+            LegendMilliseconds += Lap();
+        }
+
+        internal void EndAxes()
+        {
+            AxesMilliseconds += Lap();
+        }
+
+        internal void EndDrawable(IDrawable drawable)
+        {
+            drawables_.Add(drawable);
+            drawableTimes_.Add(Lap());
+        }
+
+        /// <summary>
+        /// Stops the clock and writes the stats to the trace source.
+        /// </summary>
+        internal void Stop()
+        {
+            TotalMilliseconds = (Stopwatch.GetTimestamp() - start_)*1000.0/Stopwatch.Frequency;
+
+            long allocated = CurrentAllocatedBytes();
+            AllocatedBytes = (allocated < 0 || startAllocated_ < 0) ? -1 : allocated - startAllocated_;
+
+            Drawables = (IDrawable[]) drawables_.ToArray(typeof (IDrawable));
+            DrawableMilliseconds = (double[]) drawableTimes_.ToArray(typeof (double));
+            drawables_ = null;
+            drawableTimes_ = null;
+
+            if (Tracing)
+            {
+                traceSource_.TraceEvent(TraceEventType.Verbose, 0, ToString());
+            }
+        }
+
+        /// <summary>
+        /// True if anyone is listening to the trace source.
+        /// </summary>
+        internal static bool Tracing
+        {
+            get { return traceSource_.Switch.ShouldTrace(TraceEventType.Verbose); }
+        }
+
+        private static long CurrentAllocatedBytes()
+        {
+            if (allocationMonitoringUnsupported_)
+                return -1;
+
+            try
+            {
+                if (AppDomain.MonitoringIsEnabled)
+                    return AppDomain.CurrentDomain.MonitoringTotalAllocatedMemorySize;
+            }
+            catch (NotImplementedException)
+            {
+                allocationMonitoringUnsupported_ = true;
+            }
+            return -1;
+        }
+
+        /// <summary>
+        /// The stats on one line, as written to the trace source.
+        /// </summary>
+        public override string ToString()
+        {
+            StringBuilder sb = new StringBuilder();
+            sb.AppendFormat(CultureInfo.InvariantCulture,
+                            "total={0:0.000}ms layout={1:0.000}ms background={2:0.000}ms title={3:0.000}ms legend={4:0.000}ms axes={5:0.000}ms allocated={6}",
+                            TotalMilliseconds, LayoutMilliseconds, BackgroundMilliseconds, TitleMilliseconds,
+                            LegendMilliseconds, AxesMilliseconds, AllocatedBytes);
+            if (Drawables != null)
+            {
+                for (int i = 0; i < Drawables.Length; ++i)
+                {
+                    sb.AppendFormat(CultureInfo.InvariantCulture, " {0}[{1}]={2:0.000}ms",
+                                    Drawables[i].GetType().Name, i, DrawableMilliseconds[i]);
+                }
+            }
+            return sb.ToString();
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,657 @@
+/*
+ * NPlot - A charting library for .NET
+ * 
+ * RollingIndicator.cs
+ * Copyright (C) 2003-2006 Matt Howlett and others.
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+using System;
+using System.Collections;
+
+namespace NPlot
+{
+    /// <summary>
+    /// A series derived from another by a rolling window calculation, such as a
+    /// moving average or volatility band. An instance can be used as the OrdinateData
+    /// of a sequence plot, in which case the DataSource, DataMember and AbscissaData
+    /// of the plot give the abscissa as usual - so the indicator can be drawn over the
+    /// series it is derived from by giving it the same abscissa.
+    /// </summary>
+    /// <remarks>
+    /// Values are worked out only when asked for, with incremental algorithms that
+    /// take a constant time per value. When a plot asks for a range of values, the
+    /// calculation starts one window before the range (at the start of the series
+    /// for Ema, which depends on all earlier values), so drawing a small part of a
+    /// long series costs little. The source is assumed to only ever be appended to:
+    /// values added since the last Update are read and included, without values
+    /// already worked out being recalculated. Call Invalidate if source values are
+    /// changed in place.
+    ///
+    /// The source values are copied when read, so the source can be any ordinate
+    /// data a LinePlot accepts. NaN source values make the result NaN for each
+    /// window that contains them (Ema skips them). The first Period - 1 values, for
+    /// which there is not a full window, are NaN.
+    /// </remarks>
+    public class RollingIndicator : IList
+    {
+        /// <summary>
+        /// The calculations available.
+        /// </summary>
+        public enum IndicatorType
+        {
+            /// <summary>
+            /// Simple moving average over the window.
+            /// </summary>
+            Sma,
+
+            /// <summary>
+            /// Exponential moving average with smoothing factor 2 / (Period + 1),
+            /// started from the simple average of the first Period values.
+            /// </summary>
+            Ema,
+
+            /// <summary>
+            /// Population standard deviation over the window.
+            /// </summary>
+            StdDev,
+
+            /// <summary>
+            /// Minimum over the window.
+            /// </summary>
+            Min,
+
+            /// <summary>
+            /// Maximum over the window.
+            /// </summary>
+            Max,
+
+            /// <summary>
+            /// Volume weighted average over the window. VolumeData must be set.
+            /// </summary>
+            Vwap,
+
+            /// <summary>
+            /// Simple moving average plus Deviations standard deviations.
+            /// </summary>
+            UpperBand,
+
+            /// <summary>
+            /// Simple moving average minus Deviations standard deviations.
+            /// </summary>
+            LowerBand
+        }
+
+        private readonly IndicatorType type_;
+        private readonly int period_;
+
+        private object dataSource_;
+        private string dataMember_;
+        private object data_;
+        private object volumeData_;
+        private double deviations_ = 2.0;
+
+        // the source values read so far.
+        private int count_;
+        private double[] input_ = new double[0];
+        private double[] volume_ = new double[0];
+        private double[] output_ = new double[0];
+
+        // values in [validFirst_, next_) have been worked out, by a calculation
+        // that started at start_ (-1 if there is none in progress).
+        private int start_ = -1;
+        private int next_;
+        private int validFirst_;
+
+        // the state of the calculation.
+        private int nanCount_;
+        private bool exact_;
+        private int sinceExact_;
+        private double mean_;
+        private double m2_;
+        private double weighted_;
+        private double weight_;
+        private int seedCount_;
+        private int[] window_;
+        private int windowHead_;
+        private int windowSize_;
+
+        /// <summary>
+        /// Constructor, for source values held in an IList.
+        /// </summary>
+        /// <param name="type">the calculation.</param>
+        /// <param name="period">the number of values in the window.</param>
+        /// <param name="data">the source values.</param>
+        public RollingIndicator(IndicatorType type, int period, object data)
+            : this(type, period, null, null, data)
+        {
+        }
+
+        /// <summary>
+        /// Constructor, for source values in a data source, specified as for the
+        /// ordinate of a LinePlot.
+        /// </summary>
+        /// <param name="type">the calculation.</param>
+        /// <param name="period">the number of values in the window.</param>
+        /// <param name="dataSource">the data source holding the source values.</param>
+        /// <param name="dataMember">the data member in a multimember data source.</param>
+        /// <param name="data">the source values, or the name of the column holding them.</param>
+        public RollingIndicator(IndicatorType type, int period, object dataSource, string dataMember, object data)
+        {
+            if (period < 1)
+            {
+                throw new NPlotException("RollingIndicator period must be at least one.");
+            }
+
+            type_ = type;
+            period_ = period;
+            dataSource_ = dataSource;
+            dataMember_ = dataMember;
+            data_ = data;
+        }
+
+        /// <summary>
+        /// The calculation.
+        /// </summary>
+        public IndicatorType Type
+        {
+            get { return type_; }
+        }
+
+        /// <summary>
+        /// The number of values in the window.
+        /// </summary>
+        public int Period
+        {
+            get { return period_; }
+        }
+
+        /// <summary>
+        /// The data source holding the source values.
+        /// </summary>
+        public object DataSource
+        {
+            get { return dataSource_; }
+            set
+            {
+                dataSource_ = value;
+                Invalidate();
+            }
+        }
+
+        /// <summary>
+        /// The data member in a multimember data source.
+        /// </summary>
+        public string DataMember
+        {
+            get { return dataMember_; }
+            set
+            {
+                dataMember_ = value;
+                Invalidate();
+            }
+        }
+
+        /// <summary>
+        /// The source values, or the name of the column holding them.
+        /// </summary>
+        public object Data
+        {
+            get { return data_; }
+            set
+            {
+                data_ = value;
+                Invalidate();
+            }
+        }
+
+        /// <summary>
+        /// The volumes used to weight the source values for Vwap, or the name of the
+        /// column holding them.
+        /// </summary>
+        public object VolumeData
+        {
+            get { return volumeData_; }
+            set
+            {
+                volumeData_ = value;
+                Invalidate();
+            }
+        }
+
+        /// <summary>
+        /// The number of standard deviations the bands are from the average. The
+        /// default is 2.
+        /// </summary>
+        public double Deviations
+        {
+            get { return deviations_; }
+            set
+            {
+                deviations_ = value;
+                Invalidate();
+            }
+        }
+
+        /// <summary>
+        /// The number of values, which is the number of source values at the last
+        /// Update.
+        /// </summary>
+        public int Count
+        {
+            get { return count_; }
+        }
+
+        /// <summary>
+        /// Gets the ith value, working it out if necessary.
+        /// </summary>
+        /// <param name="i">the index of the value.</param>
+        /// <returns>the value, or NaN if there is none.</returns>
+        public double this[int i]
+        {
+            get
+            {
+                if (i < 0 || i >= count_)
+                {
+                    throw new ArgumentOutOfRangeException("i");
+                }
+
+                if (i < validFirst_ || i >= next_)
+                {
+                    // carry on from the values already worked out if they lead up to
+                    // this one, otherwise start again one window before it.
+                    if (start_ < 0 || i < next_ || (type_ != IndicatorType.Ema && i - next_ >= period_))
+                    {
+                        Reset(type_ == IndicatorType.Ema ? 0 : Math.Max(0, i - period_ + 1));
+                    }
+                    while (next_ <= i)
+                    {
+                        output_[next_] = Step(next_);
+                        ++next_;
+                    }
+                }
+
+                return output_[i];
+            }
+        }
+
+        /// <summary>
+        /// Reads any source values added since the last Update. Sequence plots call
+        /// this each time they use the indicator.
+        /// </summary>
+        public void Update()
+        {
+            SequenceAdapter data = new SequenceAdapter(dataSource_, dataMember_, data_, null);
+            int n = data.Count;
+            if (n < count_)
+            {
+                Invalidate();
+            }
+            if (n == count_)
+            {
+                return;
+            }
+
+            if (n > input_.Length)
+            {
+                int capacity = Math.Max(n, input_.Length*2);
+                Array.Resize(ref input_, capacity);
+                Array.Resize(ref output_, capacity);
+                if (type_ == IndicatorType.Vwap)
+                {
+                    Array.Resize(ref volume_, capacity);
+                }
+            }
+
+            double[] added = new double[n - count_];
+            data.CopyTo(count_, added.Length, null, added);
+            Array.Copy(added, 0, input_, count_, added.Length);
+
+            if (type_ == IndicatorType.Vwap)
+            {
+                if (volumeData_ == null)
+                {
+                    throw new NPlotException("RollingIndicator VolumeData must be set for Vwap.");
+                }
+
+                SequenceAdapter volume = new SequenceAdapter(dataSource_, dataMember_, volumeData_, null);
+                if (volume.Count != n)
+                {
+                    throw new NPlotException("RollingIndicator VolumeData must have the same length as Data.");
+                }
+                volume.CopyTo(count_, added.Length, null, added);
+                Array.Copy(added, 0, volume_, count_, added.Length);
+            }
+
+            count_ = n;
+        }
+
+        /// <summary>
+        /// Discards the source values read and the values worked out, so that they are
+        /// read and worked out again when next needed.
+        /// </summary>
+        public void Invalidate()
+        {
+            count_ = 0;
+            start_ = -1;
+            next_ = 0;
+            validFirst_ = 0;
+        }
+
+        /// <summary>
+        /// Starts a calculation at the given index.
+        /// </summary>
+        private void Reset(int start)
+        {
+            start_ = start;
+            next_ = start;
+            validFirst_ = start == 0 ? 0 : start + period_ - 1;
+
+            nanCount_ = 0;
+            exact_ = false;
+            sinceExact_ = 0;
+            mean_ = 0.0;
+            m2_ = 0.0;
+            weighted_ = 0.0;
+            weight_ = 0.0;
+            seedCount_ = 0;
+
+            if (window_ == null)
+            {
+                window_ = new int[period_];
+            }
+            windowHead_ = 0;
+            windowSize_ = 0;
+        }
+
+        /// <summary>
+        /// True if the source value at index i can't be used.
+        /// </summary>
+        private bool IsNaN(int i)
+        {
+            return Double.IsNaN(input_[i]) || (type_ == IndicatorType.Vwap && Double.IsNaN(volume_[i]));
+        }
+
+        /// <summary>
+        /// Moves the calculation on to include the source value at index j, and
+        /// returns the value there.
+        /// </summary>
+        private double Step(int j)
+        {
+            if (type_ == IndicatorType.Ema)
+            {
+                return StepEma(j);
+            }
+
+            int old = j - period_;
+            if (IsNaN(j))
+            {
+                ++nanCount_;
+            }
+            if (old >= start_ && IsNaN(old))
+            {
+                --nanCount_;
+            }
+
+            if (type_ == IndicatorType.Min || type_ == IndicatorType.Max)
+            {
+                return StepExtreme(j, old);
+            }
+
+            if (j - start_ + 1 < period_ || nanCount_ > 0)
+            {
+                exact_ = false;
+                return Double.NaN;
+            }
+
+            // the running sums are worked out afresh once per window, which keeps
+            // the rounding errors of the incremental updates from accumulating.
+            if (!exact_ || ++sinceExact_ >= period_)
+            {
+                Exact(j);
+            }
+            else if (type_ == IndicatorType.Vwap)
+            {
+                weighted_ += input_[j]*volume_[j] - input_[old]*volume_[old];
+                weight_ += volume_[j] - volume_[old];
+            }
+            else
+            {
+                double x = input_[j];
+                double y = input_[old];
+                double mean = mean_ + (x - y)/period_;
+                m2_ = Math.Max(m2_ + (x - y)*(x - mean + y - mean_), 0.0);
+                mean_ = mean;
+            }
+
+            switch (type_)
+            {
+                case IndicatorType.Sma:
+                    return mean_;
+                case IndicatorType.StdDev:
+                    return Math.Sqrt(m2_/period_);
+                case IndicatorType.UpperBand:
+                    return mean_ + deviations_*Math.Sqrt(m2_/period_);
+                case IndicatorType.LowerBand:
+                    return mean_ - deviations_*Math.Sqrt(m2_/period_);
+                default:
+                    return weight_ != 0.0 ? weighted_/weight_ : Double.NaN;
+            }
+        }
+
+        /// <summary>
+        /// Works out the running sums for the window ending at index j directly.
+        /// </summary>
+        private void Exact(int j)
+        {
+            int first = j - period_ + 1;
+
+            if (type_ == IndicatorType.Vwap)
+            {
+                weighted_ = 0.0;
+                weight_ = 0.0;
+                for (int k = first; k <= j; ++k)
+                {
+                    weighted_ += input_[k]*volume_[k];
+                    weight_ += volume_[k];
+                }
+            }
+            else
+            {
+                double sum = 0.0;
+                for (int k = first; k <= j; ++k)
+                {
+                    sum += input_[k];
+                }
+                mean_ = sum/period_;
+
+                m2_ = 0.0;
+                for (int k = first; k <= j; ++k)
+                {
+                    m2_ += (input_[k] - mean_)*(input_[k] - mean_);
+                }
+            }
+
+            exact_ = true;
+            sinceExact_ = 0;
+        }
+
+        /// <summary>
+        /// Step for Min and Max. The window holds the indices of the values that may
+        /// yet be the extreme, in order, with the extreme at the head.
+        /// </summary>
+        private double StepExtreme(int j, int old)
+        {
+            if (windowSize_ > 0 && window_[windowHead_] == old)
+            {
+                windowHead_ = (windowHead_ + 1)%period_;
+                --windowSize_;
+            }
+
+            double x = input_[j];
+            if (!Double.IsNaN(x))
+            {
+                bool max = type_ == IndicatorType.Max;
+                while (windowSize_ > 0)
+                {
+                    double last = input_[window_[(windowHead_ + windowSize_ - 1)%period_]];
+                    if (max ? last > x : last < x)
+                    {
+                        break;
+                    }
+                    --windowSize_;
+                }
+                window_[(windowHead_ + windowSize_)%period_] = j;
+                ++windowSize_;
+            }
+
+            if (j - start_ + 1 < period_ || nanCount_ > 0)
+            {
+                return Double.NaN;
+            }
+
+            return input_[window_[windowHead_]];
+        }
+
+        /// <summary>
+        /// Step for Ema, which is always calculated from the start of the series.
+        /// </summary>
+        private double StepEma(int j)
+        {
+            double x = input_[j];
+
+            if (seedCount_ < period_)
+            {
+                if (!Double.IsNaN(x))
+                {
+                    mean_ += x;
+                    if (++seedCount_ == period_)
+                    {
+                        mean_ /= period_;
+                        return mean_;
+                    }
+                }
+                return Double.NaN;
+            }
+
+            if (!Double.IsNaN(x))
+            {
+                mean_ += 2.0/(period_ + 1)*(x - mean_);
+            }
+            return mean_;
+        }
+
+        #region IList
+
+        object IList.this[int index]
+        {
+            get { return this[index]; }
+            set { throw new NotSupportedException("RollingIndicator is read only."); }
+        }
+
+        bool IList.IsReadOnly
+        {
+            get { return true; }
+        }
+
+        bool IList.IsFixedSize
+        {
+            get { return false; }
+        }
+
+        int IList.Add(object value)
+        {
+            throw new NotSupportedException("RollingIndicator is read only.");
+        }
+
+        void IList.Clear()
+        {
+            throw new NotSupportedException("RollingIndicator is read only.");
+        }
+
+        bool IList.Contains(object value)
+        {
+            return ((IList) this).IndexOf(value) >= 0;
+        }
+
+        int IList.IndexOf(object value)
+        {
+            if (value is double)
+            {
+                for (int i = 0; i < count_; ++i)
+                {
+                    if (this[i].Equals(value))
+                    {
+                        return i;
+                    }
+                }
+            }
+            return -1;
+        }
+
+        void IList.Insert(int index, object value)
+        {
+            throw new NotSupportedException("RollingIndicator is read only.");
+        }
+
+        void IList.Remove(object value)
+        {
+            throw new NotSupportedException("RollingIndicator is read only.");
+        }
+
+        void IList.RemoveAt(int index)
+        {
+            throw new NotSupportedException("RollingIndicator is read only.");
+        }
+
+        object ICollection.SyncRoot
+        {
+            get { return this; }
+        }
+
+        bool ICollection.IsSynchronized
+        {
+            get { return false; }
+        }
+
+        void ICollection.CopyTo(Array array, int index)
+        {
+            for (int i = 0; i < count_; ++i)
+            {
+                array.SetValue(this[i], index + i);
+            }
+        }
+
+        IEnumerator IEnumerable.GetEnumerator()
+        {
+            double[] values = new double[count_];
+            for (int i = 0; i < count_; ++i)
+            {
+                values[i] = this[i];
+            }
+            return values.GetEnumerator();
+        }
+
+        #endregion
+    }
+}
\ No newline at end of file
@@ -46,6 +46,7 @@ namespace NPlot
         private readonly AdapterUtils.ICounter counter_;
         private readonly AdapterUtils.IDataGetter xDataGetter_;
         private readonly AdapterUtils.IDataGetter yDataGetter_;
+        private readonly bool abscissaSorted_;
 
         /// <summary>
         /// Constructor. The data source specifiers must be specified here.
@@ -55,8 +56,57 @@ namespace NPlot
         /// <param name="ordinateData">The source containing a list of values to plot on the ordinate axis, or a the name of the column to use for this data.</param>
         /// <param name="abscissaData">The source containing a list of values to plot on the abscissa axis, or a the name of the column to use for this data.</param>
         public SequenceAdapter(object dataSource, string dataMember, object ordinateData, object abscissaData)
+            : this(dataSource, dataMember, ordinateData, abscissaData, false)
         {
-            if (dataSource == null && dataMember == null)
+        }
+
+        /// <summary>
+        /// Constructor. The data source specifiers must be specified here.
+        /// </summary>
+        /// <param name="dataSource">The source containing a list of values to plot.</param>
+        /// <param name="dataMember">The specific data member in a multimember data source to get data from.</param>
+        /// <param name="ordinateData">The source containing a list of values to plot on the ordinate axis, or a the name of the column to use for this data.</param>
+        /// <param name="abscissaData">The source containing a list of values to plot on the abscissa axis, or a the name of the column to use for this data.</param>
+        /// <param name="abscissaSorted">If true, the abscissa data is known to be in ascending order
+        /// and contain no NaN values. Abscissa data that is a StartStep, or is not specified, is known
+        /// to be sorted regardless.</param>
+        public SequenceAdapter(object dataSource, string dataMember, object ordinateData, object abscissaData,
+                               bool abscissaSorted)
+        {
+            abscissaSorted_ = abscissaSorted;
+
+            if (ordinateData is RollingIndicator)
+            {
+                RollingIndicator indicator = (RollingIndicator) ordinateData;
+                indicator.Update();
+
+                yDataGetter_ = new AdapterUtils.DataGetter_RollingIndicator(indicator);
+                YAxisSuggester_ = new AdapterUtils.AxisSuggester_RollingIndicator(indicator);
+                counter_ = new AdapterUtils.Counter_IList(indicator);
+
+                if (abscissaData == null)
+                {
+                    XAxisSuggester_ = new AdapterUtils.AxisSuggester_Auto(indicator);
+                    xDataGetter_ = new AdapterUtils.DataGetter_Count();
+                    return;
+                }
+                else if (abscissaData is StartStep)
+                {
+                    XAxisSuggester_ = new AdapterUtils.AxisSuggester_StartStep((StartStep) abscissaData, indicator);
+                    xDataGetter_ = new AdapterUtils.DataGetter_StartStep((StartStep) abscissaData);
+                    return;
+                }
+                else
+                {
+                    // the abscissa is given by the data source as an ordinate would be.
+                    SequenceAdapter abscissa = new SequenceAdapter(dataSource, dataMember, abscissaData, null);
+                    XAxisSuggester_ = abscissa.YAxisSuggester_;
+                    xDataGetter_ = abscissa.yDataGetter_;
+                    return;
+                }
+            }
+
+            else if (dataSource == null && dataMember == null)
             {
                 if (ordinateData is IList)
                 {
@@ -136,11 +186,15 @@ namespace NPlot
                 {
                     DataView data = (DataView) dataSource;
 
-                    counter_ = new AdapterUtils.Counter_DataView(data);
-                    xDataGetter_ = new AdapterUtils.DataGetter_DataView(data, (string) abscissaData);
-                    yDataGetter_ = new AdapterUtils.DataGetter_DataView(data, (string) ordinateData);
-                    XAxisSuggester_ = new AdapterUtils.AxisSuggester_DataView(data, (string) abscissaData);
-                    YAxisSuggester_ = new AdapterUtils.AxisSuggester_DataView(data, (string) ordinateData);
+                    // extract the columns once, rather than converting every value on every draw.
+                    DataColumnCache.Column x = DataColumnCache.Get(data, (string) abscissaData);
+                    DataColumnCache.Column y = DataColumnCache.Get(data, (string) ordinateData);
+
+                    counter_ = new AdapterUtils.Counter_IList(y.Data);
+                    xDataGetter_ = new AdapterUtils.DataGetter_DoublesArray(x.Data);
+                    yDataGetter_ = new AdapterUtils.DataGetter_DoublesArray(y.Data);
+                    XAxisSuggester_ = new AdapterUtils.AxisSuggester_CachedColumn(x);
+                    YAxisSuggester_ = new AdapterUtils.AxisSuggester_CachedColumn(y);
                     return;
                 }
 
@@ -180,32 +234,38 @@ namespace NPlot
 
             else if (((dataSource is DataTable) && (dataMember == null)) || (dataSource is DataSet))
             {
-                DataRowCollection rows = null;
+                DataTable table = null;
 
                 if (dataSource is DataSet)
                 {
                     if (dataMember != null)
                     {
-                        rows = (((DataSet) dataSource).Tables[dataMember]).Rows;
+                        table = ((DataSet) dataSource).Tables[dataMember];
                     }
                     else
                     {
-                        rows = (((DataSet) dataSource).Tables[0]).Rows;
+                        table = ((DataSet) dataSource).Tables[0];
                     }
                 }
                 else
                 {
-                    rows = ((DataTable) dataSource).Rows;
+                    table = (DataTable) dataSource;
                 }
 
-                yDataGetter_ = new AdapterUtils.DataGetter_Rows(rows, (string) ordinateData);
-                YAxisSuggester_ = new AdapterUtils.AxisSuggester_Rows(rows, (string) ordinateData);
-                counter_ = new AdapterUtils.Counter_Rows(rows);
+                DataRowCollection rows = table.Rows;
+
+                // extract the columns once, rather than converting every value on every draw.
+                DataColumnCache.Column y = DataColumnCache.Get(table, (string) ordinateData);
+
+                yDataGetter_ = new AdapterUtils.DataGetter_DoublesArray(y.Data);
+                YAxisSuggester_ = new AdapterUtils.AxisSuggester_CachedColumn(y);
+                counter_ = new AdapterUtils.Counter_IList(y.Data);
 
                 if ((abscissaData is string) && (ordinateData is string))
                 {
-                    XAxisSuggester_ = new AdapterUtils.AxisSuggester_Rows(rows, (string) abscissaData);
-                    xDataGetter_ = new AdapterUtils.DataGetter_Rows(rows, (string) abscissaData);
+                    DataColumnCache.Column x = DataColumnCache.Get(table, (string) abscissaData);
+                    XAxisSuggester_ = new AdapterUtils.AxisSuggester_CachedColumn(x);
+                    xDataGetter_ = new AdapterUtils.DataGetter_DoublesArray(x.Data);
                     return;
                 }
                 else if ((abscissaData == null) && (ordinateData is string))
@@ -220,6 +280,84 @@ namespace NPlot
                 }
             }
 
+            else if ((dataSource is ColumnarFile || dataSource is ColumnarFile.RowRange) && (dataMember == null))
+            {
+                ColumnarFile.RowRange rows = dataSource as ColumnarFile.RowRange;
+                if (rows == null)
+                {
+                    ColumnarFile file = (ColumnarFile) dataSource;
+                    if (file.Count > int.MaxValue)
+                    {
+                        throw new NPlotException("Columnar file has too many rows to plot at once, use ColumnarFile.Rows to plot a range of them.");
+                    }
+                    rows = file.Rows(0, (int) file.Count);
+                }
+
+                yDataGetter_ = new AdapterUtils.DataGetter_ColumnarFile(rows, (string) ordinateData);
+                YAxisSuggester_ = new AdapterUtils.AxisSuggester_ColumnarFile(rows, (string) ordinateData);
+                counter_ = new AdapterUtils.Counter_ColumnarFile(rows);
+
+                if ((abscissaData is string) && (ordinateData is string))
+                {
+                    XAxisSuggester_ = new AdapterUtils.AxisSuggester_ColumnarFile(rows, (string) abscissaData);
+                    xDataGetter_ = new AdapterUtils.DataGetter_ColumnarFile(rows, (string) abscissaData);
+                    return;
+                }
+                else if ((abscissaData == null) && (ordinateData is string))
+                {
+                    XAxisSuggester_ = new AdapterUtils.AxisSuggester_ColumnarFile(rows, null);
+                    xDataGetter_ = new AdapterUtils.DataGetter_Count();
+                    return;
+                }
+                else
+                {
+                    // unknown.
+                }
+            }
+
+            else if ((dataSource is OhlcvData) && (dataMember == null))
+            {
+                OhlcvData data = (OhlcvData) dataSource;
+
+                DataColumnCache.Column y = data[(string) ordinateData];
+                yDataGetter_ = new AdapterUtils.DataGetter_DoublesArray(y.Data);
+                YAxisSuggester_ = new AdapterUtils.AxisSuggester_CachedColumn(y);
+                counter_ = new AdapterUtils.Counter_IList(y.Data);
+
+                if (abscissaData is string)
+                {
+                    DataColumnCache.Column x = data[(string) abscissaData];
+                    XAxisSuggester_ = new AdapterUtils.AxisSuggester_CachedColumn(x);
+                    xDataGetter_ = new AdapterUtils.DataGetter_DoublesArray(x.Data);
+                    return;
+                }
+                else if (abscissaData == null)
+                {
+                    XAxisSuggester_ = new AdapterUtils.AxisSuggester_Auto(y.Data);
+                    xDataGetter_ = new AdapterUtils.DataGetter_Count();
+                    return;
+                }
+                else
+                {
+                    // unknown.
+                }
+            }
+
+            else if ((dataSource is HistogramBinner) && (dataMember == null))
+            {
+                StartStep centers;
+                double[] counts;
+                ((HistogramBinner) dataSource).GetView(out centers, out counts);
+
+                yDataGetter_ = new AdapterUtils.DataGetter_DoublesArray(counts);
+                YAxisSuggester_ = new AdapterUtils.AxisSuggester_IList(counts);
+                counter_ = new AdapterUtils.Counter_IList(counts);
+
+                XAxisSuggester_ = new AdapterUtils.AxisSuggester_StartStep(centers, counts);
+                xDataGetter_ = new AdapterUtils.DataGetter_StartStep(centers);
+                return;
+            }
+
             else
             {
                 // unknown.
@@ -236,6 +374,19 @@ namespace NPlot
             get { return counter_.Count; }
         }
 
+        /// <summary>
+        /// True if the abscissa values are known to be in ascending order, in which
+        /// case GetIndexRange finds the range by search.
+        /// </summary>
+        public bool AbscissaSorted
+        {
+            get
+            {
+                AdapterUtils.ISortedDataGetter sorted = xDataGetter_ as AdapterUtils.ISortedDataGetter;
+                return abscissaSorted_ || (sorted != null && sorted.Sorted);
+            }
+        }
+
         /// <summary>
         /// Returns the ith point.
         /// </summary>
@@ -244,6 +395,67 @@ namespace NPlot
             get { return new PointD(xDataGetter_.Get(i), yDataGetter_.Get(i)); }
         }
 
+        /// <summary>
+        /// Finds the range of indices that need to be considered in order to draw
+        /// the data between two abscissa world values. If the abscissa data is
+        /// known to be in ascending order, the range is found by search and
+        /// includes one point either side of the interval, so that lines crossing
+        /// its ends can be drawn. Otherwise the range covers all of the data.
+        /// </summary>
+        /// <remarks>
+        /// For StartStep abscissa data the range is calculated directly, otherwise
+        /// it is found by binary search, so only O(log n) values are accessed.
+        /// </remarks>
+        /// <param name="worldMin">The minimum abscissa world value of interest.</param>
+        /// <param name="worldMax">The maximum abscissa world value of interest.</param>
+        /// <param name="first">The first index to consider.</param>
+        /// <param name="last">The last index to consider.</param>
+        public void GetIndexRange(double worldMin, double worldMax, out int first, out int last)
+        {
+            int count = Count;
+
+            first = 0;
+            last = count - 1;
+
+            if (count == 0)
+            {
+                return;
+            }
+
+            AdapterUtils.ISortedDataGetter sorted = xDataGetter_ as AdapterUtils.ISortedDataGetter;
+            if (sorted != null && sorted.Sorted)
+            {
+                first = Math.Max(sorted.Search(worldMin, count, true) - 1, 0);
+                last = Math.Min(sorted.Search(worldMax, count, false), count - 1);
+            }
+            else if (abscissaSorted_)
+            {
+                first = Math.Max(AdapterUtils.Search(xDataGetter_, worldMin, count, true) - 1, 0);
+                last = Math.Min(AdapterUtils.Search(xDataGetter_, worldMax, count, false), count - 1);
+            }
+        }
+
+        /// <summary>
+        /// Copies a run of points into the given arrays.
+        /// </summary>
+        /// <param name="first">index of the first point to copy.</param>
+        /// <param name="count">number of points to copy.</param>
+        /// <param name="x">if not null, receives the abscissa values, starting at index 0.</param>
+        /// <param name="y">if not null, receives the ordinate values, starting at index 0.</param>
+        public void CopyTo(int first, int count, double[] x, double[] y)
+        {
+            if (x != null)
+            {
+                for (int i = 0; i < count; ++i)
+                    x[i] = xDataGetter_.Get(first + i);
+            }
+            if (y != null)
+            {
+                for (int i = 0; i < count; ++i)
+                    y[i] = yDataGetter_.Get(first + i);
+            }
+        }
+
         /// <summary>
         /// Returns an x-axis that is suitable for drawing the data.
         /// </summary>
@@ -283,14 +495,23 @@ namespace NPlot
         /// <param name="onlyInRegion">If true, only data in region is written, else all data is written.</param>
         public void WriteData(StringBuilder sb, RectangleD region, bool onlyInRegion)
         {
-            for (int i = 0; i < Count; ++i)
+            int first = 0;
+            int last = Count - 1;
+            if (onlyInRegion)
+            {
+                GetIndexRange(region.X, region.X + region.Width, out first, out last);
+            }
+
+            for (int i = first; i <= last; ++i)
             {
-                if (!(onlyInRegion &&
-                      (this[i].X >= region.X && this[i].X <= region.X + region.Width) &&
-                      (this[i].Y >= region.Y && this[i].Y <= region.Y + region.Height)))
+                PointD p = this[i];
+
+                if (onlyInRegion &&
+                    !((p.X >= region.X && p.X <= region.X + region.Width) &&
+                      (p.Y >= region.Y && p.Y <= region.Y + region.Height)))
                     continue;
 
-                sb.Append(this[i].ToString());
+                sb.Append(p.ToString());
                 sb.Append("\r\n");
             }
         }
@@ -0,0 +1,148 @@
+/*
+ * NPlot - A charting library for .NET
+ * 
+ * StackGroup.cs
+ * Copyright (C) 2003-2006 Matt Howlett and others.
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+using System.Collections;
+
+namespace NPlot
+{
+    /// <summary>
+    /// The cumulative heights of a group of HistogramPlots stacked on top of one
+    /// another. For each plot in the group, the tops of its bars (its own values
+    /// plus those of every plot below it) are worked out once into an array, from
+    /// the tops of the plot it is stacked to, and reused by Draw and SuggestYAxis
+    /// until the data of the plot, or of a plot below it, changes.
+    /// </summary>
+    /// <remarks>
+    /// Changes are noticed when a data property of a plot is set, or the number of
+    /// values changes. Call Invalidate if data values are changed in place.
+    /// </remarks>
+    public class StackGroup
+    {
+        private readonly Hashtable levels_ = new Hashtable();
+
+        /// <summary>
+        /// What is cached for one plot in the group.
+        /// </summary>
+        private class Level
+        {
+            public object[] Source;
+            public SequenceAdapter Data;
+            public double[] Below;
+            public double[] Tops;
+        }
+
+        /// <summary>
+        /// Constructor. A group is made by the bottom plot of a stack, see
+        /// HistogramPlot.StackGroup.
+        /// </summary>
+        internal StackGroup()
+        {
+        }
+
+        /// <summary>
+        /// Discards all cumulative heights, so that they are worked out again the
+        /// next time they are needed.
+        /// </summary>
+        public void Invalidate()
+        {
+            levels_.Clear();
+        }
+
+        /// <summary>
+        /// The heights of the tops of the bars of a plot in the group: its own values
+        /// plus the values of all plots it is stacked on.
+        /// </summary>
+        /// <param name="plot">a plot in the group.</param>
+        /// <returns>the heights, one per data point. Not to be modified.</returns>
+        public double[] Tops(HistogramPlot plot)
+        {
+            double[] below = Baselines(plot);
+
+            object[] source = {plot.DataSource, plot.DataMember, plot.OrdinateData, plot.AbscissaData};
+
+            Level level = (Level) levels_[plot];
+            bool same = level != null;
+            for (int i = 0; same && i < source.Length; ++i)
+            {
+                same = Equals(source[i], level.Source[i]);
+            }
+
+            SequenceAdapter data;
+            if (same)
+            {
+                data = level.Data;
+                if (level.Below == below && level.Tops.Length == data.Count)
+                {
+                    return level.Tops;
+                }
+            }
+            else
+            {
+                data = new SequenceAdapter(plot.DataSource, plot.DataMember, plot.OrdinateData, plot.AbscissaData);
+            }
+
+            int n = data.Count;
+            if (below != null && below.Length != n)
+            {
+                throw new NPlotException("Can stack HistogramPlot data only with the same number of datapoints.");
+            }
+
+            double[] tops = new double[n];
+            data.CopyTo(0, n, null, tops);
+            if (below != null)
+            {
+                for (int i = 0; i < n; ++i)
+                {
+                    tops[i] += below[i];
+                }
+            }
+
+            level = new Level();
+            level.Source = source;
+            level.Data = data;
+            level.Below = below;
+            level.Tops = tops;
+            levels_[plot] = level;
+
+            return tops;
+        }
+
+        /// <summary>
+        /// The heights of the bottoms of the bars of a plot in the group, which are
+        /// the tops of the plot it is stacked to.
+        /// </summary>
+        /// <param name="plot">a plot in the group.</param>
+        /// <returns>the heights, one per data point, or null if plot is the bottom of the stack.</returns>
+        public double[] Baselines(HistogramPlot plot)
+        {
+            if (plot.StackedToPlot == null)
+                return null;
+            return Tops(plot.StackedToPlot);
+        }
+    }
+}
\ No newline at end of file
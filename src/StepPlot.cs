@@ -126,12 +126,24 @@ namespace NPlot
         public virtual void Draw(Graphics g, PhysicalAxis xAxis, PhysicalAxis yAxis)
         {
             SequenceAdapter data =
-                new SequenceAdapter(DataSource, DataMember, OrdinateData, AbscissaData);
+                new SequenceAdapter(DataSource, DataMember, OrdinateData, AbscissaData, AbscissaSorted);
 
             double leftCutoff = xAxis.PhysicalToWorld(xAxis.PhysicalMin, false);
             double rightCutoff = xAxis.PhysicalToWorld(xAxis.PhysicalMax, false);
 
-            for (int i = 0; i < data.Count; ++i)
+            // only consider steps near the visible range. Widen by one either
+            // side, as centering can shift a step by half its width.
+            int first = 0;
+            int last = data.Count - 1;
+            if (!xAxis.ReferencePath)
+            {
+                data.GetIndexRange(Math.Min(leftCutoff, rightCutoff), Math.Max(leftCutoff, rightCutoff),
+                                   out first, out last);
+                first = Math.Max(first - 1, 0);
+                last = Math.Min(last + 1, data.Count - 1);
+            }
+
+            for (int i = first; i <= last; ++i)
             {
                 PointD p1 = data[i];
                 if (Double.IsNaN(p1.X) || Double.IsNaN(p1.Y))
@@ -0,0 +1,120 @@
+/*
+ * NPlot - A charting library for .NET
+ * 
+ * StringSizeCache.cs
+ * Copyright (C) 2003-2006 Matt Howlett and others.
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+using System.Collections;
+using System.Drawing;
+using System.Drawing.Text;
+
+namespace NPlot
+{
+    /// <summary>
+    /// Remembers the sizes of strings measured in a particular font, so that text
+    /// drawn again and again (point labels, say) is measured only once. Measuring is
+    /// one of the most expensive GDI+ text operations.
+    /// </summary>
+    /// <remarks>
+    /// Measurements depend on the graphics surface as well as the font. The cache is
+    /// emptied when a different font is used, or when the resolution, units, scale or
+    /// text rendering of the surface differ from those of the previous measurement.
+    /// Otherwise strings are forgotten by generation: when the current generation
+    /// is full it becomes the old one and the previous old one is dropped. A string
+    /// found in the old generation is moved to the current one, so strings that are
+    /// still being drawn are kept.
+    /// </remarks>
+    internal class StringSizeCache
+    {
+        private const int generationCapacity_ = 4096;
+
+        private Hashtable sizes_ = new Hashtable();
+        private Hashtable oldSizes_ = new Hashtable();
+
+        private Font font_;
+        private float dpiX_;
+        private float dpiY_;
+        private GraphicsUnit pageUnit_;
+        private float pageScale_;
+        private TextRenderingHint textRenderingHint_;
+
+        /// <summary>
+        /// Gets the size of a string as measured by Graphics.MeasureString.
+        /// </summary>
+        /// <param name="g">the graphics surface the string will be drawn on.</param>
+        /// <param name="text">the string.</param>
+        /// <param name="font">the font the string will be drawn in.</param>
+        /// <returns>the size of the string.</returns>
+        public SizeF Measure(Graphics g, string text, Font font)
+        {
+            if (font != font_ || g.DpiX != dpiX_ || g.DpiY != dpiY_ ||
+                g.PageUnit != pageUnit_ || g.PageScale != pageScale_ ||
+                g.TextRenderingHint != textRenderingHint_)
+            {
+                sizes_.Clear();
+                oldSizes_.Clear();
+                font_ = font;
+                dpiX_ = g.DpiX;
+                dpiY_ = g.DpiY;
+                pageUnit_ = g.PageUnit;
+                pageScale_ = g.PageScale;
+                textRenderingHint_ = g.TextRenderingHint;
+            }
+
+            object size = sizes_[text];
+            if (size != null)
+            {
+                return (SizeF) size;
+            }
+
+            size = oldSizes_[text];
+            if (size == null)
+            {
+                size = g.MeasureString(text, font);
+            }
+
+            if (sizes_.Count >= generationCapacity_)
+            {
+                Hashtable dropped = oldSizes_;
+                oldSizes_ = sizes_;
+                sizes_ = dropped;
+                sizes_.Clear();
+            }
+
+            sizes_[text] = size;
+            return (SizeF) size;
+        }
+
+        /// <summary>
+        /// Forgets all measurements.
+        /// </summary>
+        public void Clear()
+        {
+            sizes_.Clear();
+            oldSizes_.Clear();
+            font_ = null;
+        }
+    }
+}
\ No newline at end of file
@@ -42,11 +42,21 @@ namespace NPlot
         // to WorldMin/Max are captured here
 
         private long endTradingTime_;
+        private DateTime[] holidays_;
         private long startTradingTime_;
         private long tradingTimeSpan_;
         private double virtualWorldMax_ = double.NaN;
         private double virtualWorldMin_ = double.NaN;
 
+        // the session calendar index. Sessions are numbered by counting the
+        // Mon - Fri days from Ticks == 0. holidaySessions_ holds the numbers of
+        // the sessions removed as holidays in ascending order, so the position of
+        // a holiday in it is the number of sessions removed before it.
+        // collapsedHolidaySessions_[i] is holidaySessions_[i] - i, the number the
+        // holiday would have had in the collapsed (virtual) numbering.
+        private long[] holidaySessions_;
+        private long[] collapsedHolidaySessions_;
+
         /// <summary>
         /// Constructor
         /// </summary>
@@ -110,6 +120,7 @@ namespace NPlot
             {
                 startTradingTime_ = value.Ticks;
                 tradingTimeSpan_ = endTradingTime_ - startTradingTime_;
+                UpdateVirtualWorld();
             }
         }
 
@@ -124,6 +135,23 @@ namespace NPlot
             {
                 endTradingTime_ = value.Ticks;
                 tradingTimeSpan_ = endTradingTime_ - startTradingTime_;
+                UpdateVirtualWorld();
+            }
+        }
+
+        /// <summary>
+        /// Optional list of days on which there is no trading in addition to
+        /// Saturdays and Sundays. Only the date part of each value is used. Like
+        /// weekends, these days are collapsed out of the axis.
+        /// </summary>
+        public DateTime[] Holidays
+        {
+            get { return holidays_ == null ? null : (DateTime[]) holidays_.Clone(); }
+            set
+            {
+                holidays_ = value == null ? null : (DateTime[]) value.Clone();
+                BuildSessionIndex();
+                UpdateVirtualWorld();
             }
         }
 
@@ -151,10 +179,92 @@ namespace NPlot
             startTradingTime_ = 0;
             endTradingTime_ = TimeSpan.TicksPerDay;
             tradingTimeSpan_ = endTradingTime_ - startTradingTime_;
+            UpdateVirtualWorld();
+        }
+
+        /// <summary>
+        /// Recalculates the shadow virtual world extents after a change in the
+        /// way the world is remapped.
+        /// </summary>
+        private void UpdateVirtualWorld()
+        {
             virtualWorldMin_ = SparseWorldRemap(WorldMin);
             virtualWorldMax_ = SparseWorldRemap(WorldMax);
         }
 
+        /// <summary>
+        /// Builds the session calendar index from the holiday list.
+        /// </summary>
+        private void BuildSessionIndex()
+        {
+            holidaySessions_ = null;
+            collapsedHolidaySessions_ = null;
+
+            if (holidays_ == null)
+                return;
+
+            long[] sessions = new long[holidays_.Length];
+            int count = 0;
+            for (int i = 0; i < holidays_.Length; ++i)
+            {
+                long whole_days = holidays_[i].Ticks/TimeSpan.TicksPerDay;
+                if (whole_days%7 >= 5)
+                    continue; // weekends are collapsed anyway.
+                sessions[count++] = (whole_days/7)*5 + whole_days%7;
+            }
+
+            Array.Sort(sessions, 0, count);
+
+            // remove duplicates.
+            int unique = 0;
+            for (int i = 0; i < count; ++i)
+            {
+                if (unique == 0 || sessions[i] != sessions[unique - 1])
+                    sessions[unique++] = sessions[i];
+            }
+
+            if (unique == 0)
+                return;
+
+            holidaySessions_ = new long[unique];
+            collapsedHolidaySessions_ = new long[unique];
+            for (int i = 0; i < unique; ++i)
+            {
+                holidaySessions_[i] = sessions[i];
+                collapsedHolidaySessions_[i] = sessions[i] - i;
+            }
+        }
+
+        /// <summary>
+        /// Returns the number of values in the ascending array a that are not greater than v.
+        /// </summary>
+        private static int CountNotGreater(long[] a, long v)
+        {
+            int lo = 0;
+            int hi = a.Length;
+            while (lo < hi)
+            {
+                int mid = (lo + hi)/2;
+                if (a[mid] <= v)
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+            return lo;
+        }
+
+        /// <summary>
+        /// Whether or not the session with the given number is a holiday.
+        /// </summary>
+        private bool IsHolidaySession(long session)
+        {
+            if (holidaySessions_ == null)
+                return false;
+
+            int k = CountNotGreater(holidaySessions_, session);
+            return k > 0 && holidaySessions_[k - 1] == session;
+        }
+
         /// <summary>
         /// Deep copy of DateTimeAxis.
         /// </summary>
@@ -182,6 +292,9 @@ namespace NPlot
             a.startTradingTime_ = b.startTradingTime_;
             a.endTradingTime_ = b.endTradingTime_;
             a.tradingTimeSpan_ = b.tradingTimeSpan_;
+            a.holidays_ = b.holidays_;
+            a.holidaySessions_ = b.holidaySessions_;
+            a.collapsedHolidaySessions_ = b.collapsedHolidaySessions_;
             a.WorldMin = b.WorldMin;
             a.WorldMax = b.WorldMax;
         }
@@ -285,6 +398,98 @@ namespace NPlot
             return new PointF(_physicalMin.X + offset.X, _physicalMin.Y + offset.Y);
         }
 
+        /// <summary>
+        /// World to physical coordinate transform of many values at once. The result
+        /// is the same as calling WorldToPhysical with clip false for each value,
+        /// except that NaN values transform to NaN.
+        /// </summary>
+        /// <remarks>
+        /// All points on one day share the same remapping apart from the time
+        /// of day, so the calendar lookup is only done when the day changes. For
+        /// intraday data in time order that is once per session.
+        /// </remarks>
+        /// <param name="coords">The coordinate values to transform.</param>
+        /// <param name="start">Index in coords of the first value to transform.</param>
+        /// <param name="count">The number of values to transform.</param>
+        /// <param name="physicalMin">The physical position corresponding to the world minimum of the axis.</param>
+        /// <param name="physicalMax">The physical position corresponding to the world maximum of the axis.</param>
+        /// <param name="x">If not null, receives the physical x positions, starting at index 0.</param>
+        /// <param name="y">If not null, receives the physical y positions, starting at index 0.</param>
+        public override void WorldToPhysical(
+            double[] coords, int start, int count,
+            PointF physicalMin, PointF physicalMax,
+            float[] x, float[] y)
+        {
+            if (Reversed)
+            {
+                PointF tmp = physicalMin;
+                physicalMin = physicalMax;
+                physicalMax = tmp;
+            }
+
+            float physicalX = physicalMax.X - physicalMin.X;
+            float physicalY = physicalMax.Y - physicalMin.Y;
+
+            double range = virtualWorldMax_ - virtualWorldMin_;
+
+            const double largeClip = 100.0;
+
+            long currentDay = 0;
+            bool haveDay = false;
+            bool tradingDay = false;
+            long dayStart = 0; // virtual position of the start of the current day.
+
+            for (int i = 0; i < count; ++i)
+            {
+                double coord = coords[start + i];
+                if (Double.IsNaN(coord))
+                {
+                    if (x != null)
+                        x[i] = Single.NaN;
+                    if (y != null)
+                        y[i] = Single.NaN;
+                    continue;
+                }
+
+                long ticks = (long) coord;
+                long whole_days = ticks/TimeSpan.TicksPerDay;
+
+                if (!haveDay || whole_days != currentDay)
+                {
+                    currentDay = whole_days;
+                    haveDay = true;
+                    dayStart = (long) SparseWorldRemap(whole_days*TimeSpan.TicksPerDay);
+                    tradingDay = OnTradingDays(whole_days*TimeSpan.TicksPerDay);
+                }
+
+                long virtualTicks = dayStart;
+                if (tradingDay)
+                {
+                    long ticks_in_last_day = ticks%TimeSpan.TicksPerDay;
+                    if (ticks_in_last_day < startTradingTime_) ticks_in_last_day = startTradingTime_;
+                    else if (ticks_in_last_day > endTradingTime_) ticks_in_last_day = endTradingTime_;
+                    virtualTicks += ticks_in_last_day - startTradingTime_;
+                }
+
+                double virtualCoord = virtualTicks;
+                double prop = ((virtualCoord - virtualWorldMin_)/range);
+
+                if (range == 0)
+                {
+                    if (virtualCoord >= virtualWorldMin_)
+                        prop = largeClip;
+
+                    if (virtualCoord < virtualWorldMin_)
+                        prop = -largeClip;
+                }
+
+                if (x != null)
+                    x[i] = physicalMin.X + (float) (prop*physicalX);
+                if (y != null)
+                    y[i] = physicalMin.Y + (float) (prop*physicalY);
+            }
+        }
+
         /// <summary>
         /// Transforms a physical coordinate to an axis world
         /// coordinate given the physical extremites of the axis.
@@ -373,6 +578,16 @@ namespace NPlot
             ticks_in_last_day -= startTradingTime_;
 
             long whole_working_days = (full_weeks*5 + days_in_last_week);
+
+            if (holidaySessions_ != null)
+            {
+                // sessions removed before this one, and collapse the day if it is one of them.
+                int removed = CountNotGreater(holidaySessions_, whole_working_days - 1);
+                if (removed < holidaySessions_.Length && holidaySessions_[removed] == whole_working_days)
+                    ticks_in_last_day = 0;
+                whole_working_days -= removed;
+            }
+
             long working_ticks = whole_working_days*tradingTimeSpan_;
             long new_ticks = working_ticks + ticks_in_last_day;
             return new_ticks;
@@ -389,6 +604,13 @@ namespace NPlot
             //ticks += startTradingTime_;
             long ticks_in_last_day = ticks%tradingTimeSpan_;
             ticks /= tradingTimeSpan_;
+
+            if (collapsedHolidaySessions_ != null)
+            {
+                // skip over the holidays at or before this session.
+                ticks += CountNotGreater(collapsedHolidaySessions_, ticks);
+            }
+
             long full_weeks = ticks/5;
             long week_part = ticks%5;
 
@@ -422,6 +644,8 @@ namespace NPlot
             long days_in_last_week = whole_days%7;
             if (days_in_last_week >= 5)
                 return false;
+            if (IsHolidaySession((whole_days/7)*5 + days_in_last_week))
+                return false;
 
             if (ticks_in_last_day < startTradingTime_) return false;
             if (ticks_in_last_day >= endTradingTime_) return false;
@@ -433,13 +657,15 @@ namespace NPlot
         /// Check whether the given coordinate falls on trading days.
         /// </summary>
         /// <param name="coord">world coordinate in ticks to check.</param>
-        /// <returns>true if on Mon - Fri.</returns>
+        /// <returns>true if on Mon - Fri and not a holiday.</returns>
         public bool OnTradingDays(double coord)
         {
             long ticks = (long) coord;
             long whole_days = ticks/TimeSpan.TicksPerDay;
             long days_in_last_week = whole_days%7;
-            return (days_in_last_week < 5);
+            if (days_in_last_week >= 5)
+                return false;
+            return !IsHolidaySession((whole_days/7)*5 + days_in_last_week);
         }
 
         /// <summary>
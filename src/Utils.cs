@@ -30,6 +30,7 @@ using System;
 using System.Collections;
 using System.Data;
 using System.Drawing;
+using System.Drawing.Imaging;
 
 namespace NPlot
 {
@@ -314,20 +315,24 @@ namespace NPlot
         }
 
         /// <summary>
-        /// Creates a bitmap from another that is tiled size times in each direction.
+        /// Creates a bitmap of the given size covered by copies of another.
         /// </summary>
         /// <param name="image">bitmap to tile</param>
-        /// <param name="size">number of times to tile in each direction.</param>
+        /// <param name="size">the size of the bitmap to create.</param>
         /// <returns>the tiled bitmap.</returns>
         public static System.Drawing.Bitmap TiledImage(System.Drawing.Bitmap image, Size size)
         {
-            System.Drawing.Bitmap final = new System.Drawing.Bitmap(size.Width, size.Height);
+            System.Drawing.Bitmap final =
+                new System.Drawing.Bitmap(size.Width, size.Height, PixelFormat.Format32bppPArgb);
 
-            for (int i = 0; i < (size.Width/image.Width) + 1; ++i)
+            using (Graphics g = Graphics.FromImage(final))
             {
-                for (int j = 0; j < (size.Height/image.Height) + 1; ++j)
+                for (int i = 0; i < (size.Width/image.Width) + 1; ++i)
                 {
-                    Graphics.FromImage(final).DrawImage(image, i*image.Width, j*image.Height);
+                    for (int j = 0; j < (size.Height/image.Height) + 1; ++j)
+                    {
+                        g.DrawImage(image, i*image.Width, j*image.Height);
+                    }
                 }
             }
 
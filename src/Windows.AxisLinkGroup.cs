@@ -0,0 +1,335 @@
+/*
+ * NPlot - A charting library for .NET
+ * 
+ * Windows.AxisLinkGroup.cs
+ * Copyright (C) 2003-2006 Matt Howlett and others.
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+using System;
+using System.Collections;
+using System.Windows.Forms;
+
+namespace NPlot.Windows
+{
+    /// <summary>
+    /// Links the world extents of axes across a number of Windows.Forms
+    /// PlotSurface2D controls, for example the price and volume panes of a
+    /// financial chart.
+    /// </summary>
+    /// <remarks>
+    /// When an interaction or a zoom reset changes one member, the world extents
+    /// of its linked axes are copied into the existing axes of every other member
+    /// (axes are not replaced or cloned, so labels and other settings of each
+    /// member are kept). Changes are batched: however many events arrive before
+    /// the message loop gets to it, the axes are copied once and every member is
+    /// invalidated once, so all panes are painted together in the next frame.
+    ///
+    /// The members share a zoom history: when an interaction starts on one member
+    /// every member records its view, and going back or forward on one member moves
+    /// every member through its own history. Each member can then show the image it
+    /// kept of the view (see PlotSurface2D.ZoomHistoryMemory) instead of drawing.
+    /// </remarks>
+    public class AxisLinkGroup
+    {
+        /// <summary>
+        /// The axes of each member that are kept in step.
+        /// </summary>
+        [Flags]
+        public enum Axes
+        {
+            /// <summary>
+            /// No axes.
+            /// </summary>
+            None = 0,
+
+            /// <summary>
+            /// The lower x axis.
+            /// </summary>
+            XAxis1 = 1,
+
+            /// <summary>
+            /// The upper x axis.
+            /// </summary>
+            XAxis2 = 2,
+
+            /// <summary>
+            /// The left y axis.
+            /// </summary>
+            YAxis1 = 4,
+
+            /// <summary>
+            /// The right y axis.
+            /// </summary>
+            YAxis2 = 8
+        }
+
+        private readonly ArrayList members_ = new ArrayList();
+        private Axes linkedAxes_;
+
+        private PlotSurface2D source_;
+        private bool interactive_;
+        private bool pending_;
+
+        /// <summary>
+        /// Constructor. Links XAxis1 of the members.
+        /// </summary>
+        public AxisLinkGroup()
+            : this(Axes.XAxis1)
+        {
+        }
+
+        /// <summary>
+        /// Constructor.
+        /// </summary>
+        /// <param name="linkedAxes">The axes of each member to keep in step.</param>
+        public AxisLinkGroup(Axes linkedAxes)
+        {
+            linkedAxes_ = linkedAxes;
+        }
+
+        /// <summary>
+        /// The axes of each member that are kept in step.
+        /// </summary>
+        public Axes LinkedAxes
+        {
+            get { return linkedAxes_; }
+            set { linkedAxes_ = value; }
+        }
+
+        /// <summary>
+        /// The number of plot surfaces in the group.
+        /// </summary>
+        public int Count
+        {
+            get { return members_.Count; }
+        }
+
+        /// <summary>
+        /// Adds a plot surface to the group. A plot surface can be a member of
+        /// only one group at a time.
+        /// </summary>
+        /// <param name="ps">The plot surface to add.</param>
+        public void Add(PlotSurface2D ps)
+        {
+            if (ps == null)
+            {
+                throw new NPlotException("Can not add a null plot surface to an axis link group.");
+            }
+            if (ps.LinkGroup == this)
+            {
+                return;
+            }
+            if (ps.LinkGroup != null)
+            {
+                throw new NPlotException("Plot surface is already a member of another axis link group.");
+            }
+            ps.LinkGroup = this;
+            members_.Add(ps);
+        }
+
+        /// <summary>
+        /// Removes a plot surface from the group.
+        /// </summary>
+        /// <param name="ps">The plot surface to remove.</param>
+        public void Remove(PlotSurface2D ps)
+        {
+            if (ps == null || ps.LinkGroup != this)
+            {
+                return;
+            }
+            ps.LinkGroup = null;
+            members_.Remove(ps);
+            if (source_ == ps)
+            {
+                source_ = null;
+            }
+        }
+
+        /// <summary>
+        /// Tells the group that the linked axes of a member have changed. The
+        /// other members are brought into step, and all members repainted, once
+        /// the message loop is next idle. Call this after changing the axes of a
+        /// member from code; interactions and zoom resets call it automatically.
+        /// </summary>
+        /// <param name="source">The member whose axes changed.</param>
+        public void RangeChanged(PlotSurface2D source)
+        {
+            RangeChanged(source, false);
+        }
+
+        /// <summary>
+        /// Tells the group that the linked axes of a member have changed.
+        /// </summary>
+        /// <param name="source">The member whose axes changed.</param>
+        /// <param name="interactive">true if the change came from an interaction in progress, in which case members are drawn as previews.</param>
+        internal void RangeChanged(PlotSurface2D source, bool interactive)
+        {
+            // the most recent change wins. Any earlier change from the same
+            // frame is already reflected in the source's axes.
+            source_ = source;
+            interactive_ |= interactive;
+
+            if (pending_)
+            {
+                return;
+            }
+
+            if (source.IsHandleCreated && !source.IsDisposed)
+            {
+                pending_ = true;
+                source.BeginInvoke(new MethodInvoker(Flush));
+            }
+            else
+            {
+                Flush();
+            }
+        }
+
+        /// <summary>
+        /// Copies the linked axis extents of the last changed member to all other
+        /// members, then invalidates every member.
+        /// </summary>
+        private void Flush()
+        {
+            PlotSurface2D source = source_;
+            bool interactive = interactive_;
+            source_ = null;
+            interactive_ = false;
+            pending_ = false;
+
+            if (source == null)
+            {
+                return;
+            }
+
+            for (int i = 0; i < members_.Count; ++i)
+            {
+                PlotSurface2D ps = (PlotSurface2D) members_[i];
+                if (ps.IsDisposed)
+                {
+                    continue;
+                }
+
+                if (ps != source)
+                {
+                    CopyLinkedExtents(source, ps);
+                }
+
+                ps.InvalidateLinked(interactive);
+            }
+        }
+
+        /// <summary>
+        /// Adds the current view of every member to its zoom history, at the start of
+        /// an interaction on one of them.
+        /// </summary>
+        internal void RecordZoom()
+        {
+            for (int i = 0; i < members_.Count; ++i)
+            {
+                PlotSurface2D ps = (PlotSurface2D) members_[i];
+                if (!ps.IsDisposed)
+                {
+                    ps.RecordZoom();
+                }
+            }
+        }
+
+        /// <summary>
+        /// Moves every member through its zoom history. The views were recorded
+        /// together, so the linked axes of the members stay in step without being
+        /// copied, and each member can show its kept image. A member with no view to
+        /// go to (one added to the group later, say) is brought into step with the
+        /// source instead.
+        /// </summary>
+        /// <param name="source">The member the zoom was asked of.</param>
+        /// <param name="direction">-1 to go back a view, 1 to go forward a view, 0 to go back to the first view.</param>
+        internal void ZoomHistory(PlotSurface2D source, int direction)
+        {
+            if (!source.StepZoomHistory(direction))
+            {
+                if (direction == 0)
+                {
+                    RangeChanged(source, false);
+                }
+                return;
+            }
+
+            // any change not yet flushed is superseded by the views gone to.
+            source_ = null;
+            interactive_ = false;
+
+            for (int i = 0; i < members_.Count; ++i)
+            {
+                PlotSurface2D ps = (PlotSurface2D) members_[i];
+                if (ps == source || ps.IsDisposed)
+                {
+                    continue;
+                }
+
+                if (!ps.StepZoomHistory(direction))
+                {
+                    CopyLinkedExtents(source, ps);
+                    ps.InvalidateLinked(false);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Sets the world extents of the linked axes of a member to those of another.
+        /// </summary>
+        private void CopyLinkedExtents(PlotSurface2D from, PlotSurface2D to)
+        {
+            if ((linkedAxes_ & Axes.XAxis1) != 0)
+            {
+                CopyExtents(from.XAxis1, to.XAxis1);
+            }
+            if ((linkedAxes_ & Axes.XAxis2) != 0)
+            {
+                CopyExtents(from.XAxis2, to.XAxis2);
+            }
+            if ((linkedAxes_ & Axes.YAxis1) != 0)
+            {
+                CopyExtents(from.YAxis1, to.YAxis1);
+            }
+            if ((linkedAxes_ & Axes.YAxis2) != 0)
+            {
+                CopyExtents(from.YAxis2, to.YAxis2);
+            }
+        }
+
+        /// <summary>
+        /// Sets the world extents of one axis to those of another.
+        /// </summary>
+        private static void CopyExtents(Axis from, Axis to)
+        {
+            if (from == null || to == null || from == to)
+            {
+                return;
+            }
+            to.WorldMin = from.WorldMin;
+            to.WorldMax = from.WorldMax;
+        }
+    }
+}
\ No newline at end of file
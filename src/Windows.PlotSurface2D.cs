@@ -31,6 +31,7 @@ using System.Collections;
 using System.ComponentModel;
 using System.Drawing;
 using System.Drawing.Drawing2D;
+using System.Drawing.Imaging;
 using System.Drawing.Printing;
 using System.Text;
 using System.Windows.Forms;
@@ -65,14 +66,24 @@ namespace NPlot.Windows
 
         private ToolTip coordinates_;
         private KeyEventArgs lastKeyEventArgs_;
+        private AxisLinkGroup linkGroup_;
+        private bool previewNext_;
+        private bool previewShown_;
+        private Timer refinementTimer_;
         private PlotContextMenu rightMenu_;
 
         //private ArrayList selectedObjects_;
 
-        private Axis xAxis1ZoomCache_;
-        private Axis xAxis2ZoomCache_;
-        private Axis yAxis1ZoomCache_;
-        private Axis yAxis2ZoomCache_;
+        private readonly ArrayList zoomBack_ = new ArrayList();
+        private readonly ArrayList zoomForward_ = new ArrayList();
+        private bool zoomRecorded_;
+        private int zoomHistoryLength_ = 32;
+        private long zoomHistoryMemory_ = 32L*1024*1024;
+        private long dataVersion_;
+
+        // image of a view restored from the zoom history, shown until invalidated.
+        private System.Drawing.Bitmap frame_;
+        private long frameVersion_;
 
         /// <summary>
         /// Default constructor.
@@ -90,6 +101,8 @@ namespace NPlot.Windows
 
             ps_ = new NPlot.PlotSurface2D();
 
+            ProgressiveRefinement = true;
+
             InteractionOccured += OnInteractionOccured;
             PreRefresh += OnPreRefresh;
         }
@@ -161,6 +174,29 @@ namespace NPlot.Windows
          Description("When true, tool tip will display x value as a DateTime. Quick hack - this will probably be changed at some point.")]
         public bool DateTimeToolTip { get; set; }
 
+        /// <summary>
+        /// If a data point is drawn within this many pixels of the mouse, the coordinates
+        /// tool tip shows the plot and coordinates of that point instead of the
+        /// coordinates of the mouse. Zero, the default, turns this off. Data with
+        /// abscissa values not known to be sorted is scanned when the view changes.
+        /// </summary>
+        [Bindable(true), Browsable(true), Category("PlotSurface2D"),
+         Description("Distance in pixels from the mouse within which the coordinates tool tip snaps to the nearest data point. Zero turns this off.")]
+        public int ToolTipPointRadius { get; set; }
+
+        /// <summary>
+        /// Finds the data point drawn nearest to a physical position.
+        /// </summary>
+        /// <param name="p">The physical position.</param>
+        /// <param name="radius">Only points within this physical distance of p are considered.</param>
+        /// <param name="plot">The plot containing the point found, or null if there is none.</param>
+        /// <param name="index">The index of the point found within the plot's data, or -1 if there is none.</param>
+        /// <returns>true if a point was found.</returns>
+        public bool NearestPoint(Point p, int radius, out BaseSequencePlot plot, out int index)
+        {
+            return ps_.NearestPoint(p, radius, out plot, out index);
+        }
+
         /// <summary>
         /// Sets the right context menu. Custom menus can be designed by overriding
         /// NPlot.Windows.PlotSurface2D.ContextMenu.
@@ -208,10 +244,8 @@ namespace NPlot.Windows
         /// </summary>
         public void Clear()
         {
-            xAxis1ZoomCache_ = null;
-            yAxis1ZoomCache_ = null;
-            xAxis2ZoomCache_ = null;
-            yAxis2ZoomCache_ = null;
+            ClearZoomHistory();
+            ++dataVersion_;
             ps_.Clear();
             interactions_.Clear();
         }
@@ -224,6 +258,7 @@ namespace NPlot.Windows
         public void Add(IDrawable p)
         {
             ps_.Add(p);
+            ++dataVersion_;
         }
 
         /// <summary>
@@ -236,6 +271,7 @@ namespace NPlot.Windows
         public void Add(IDrawable p, NPlot.PlotSurface2D.XAxisPosition xp, NPlot.PlotSurface2D.YAxisPosition yp)
         {
             ps_.Add(p, xp, yp);
+            ++dataVersion_;
         }
 
         /// <summary>
@@ -247,6 +283,7 @@ namespace NPlot.Windows
         public void Add(IDrawable p, int zOrder)
         {
             ps_.Add(p, zOrder);
+            ++dataVersion_;
         }
 
         /// <summary>
@@ -261,6 +298,7 @@ namespace NPlot.Windows
                         NPlot.PlotSurface2D.YAxisPosition yp, int zOrder)
         {
             ps_.Add(p, xp, yp, zOrder);
+            ++dataVersion_;
         }
 
         /// <summary>
@@ -273,7 +311,11 @@ namespace NPlot.Windows
         public Legend Legend
         {
             get { return ps_.Legend; }
-            set { ps_.Legend = value; }
+            set
+            {
+                ps_.Legend = value;
+                ++dataVersion_;
+            }
         }
 
         /// <summary>
@@ -289,7 +331,11 @@ namespace NPlot.Windows
         public int LegendZOrder
         {
             get { return ps_.LegendZOrder; }
-            set { ps_.LegendZOrder = value; }
+            set
+            {
+                ps_.LegendZOrder = value;
+                ++dataVersion_;
+            }
         }
 
         /// <summary>
@@ -305,7 +351,11 @@ namespace NPlot.Windows
         public bool AutoScaleTitle
         {
             get { return ps_.AutoScaleTitle; }
-            set { ps_.AutoScaleTitle = value; }
+            set
+            {
+                ps_.AutoScaleTitle = value;
+                ++dataVersion_;
+            }
         }
 
         /// <summary>
@@ -328,7 +378,11 @@ namespace NPlot.Windows
         public bool AutoScaleAutoGeneratedAxes
         {
             get { return ps_.AutoScaleAutoGeneratedAxes; }
-            set { ps_.AutoScaleAutoGeneratedAxes = value; }
+            set
+            {
+                ps_.AutoScaleAutoGeneratedAxes = value;
+                ++dataVersion_;
+            }
         }
 
         /// <summary>
@@ -346,6 +400,7 @@ namespace NPlot.Windows
             set
             {
                 ps_.Title = value;
+                ++dataVersion_;
                 //helpful in design view. But crap in applications!
                 //this.Refresh();
             }
@@ -363,7 +418,11 @@ namespace NPlot.Windows
         public Font TitleFont
         {
             get { return ps_.TitleFont; }
-            set { ps_.TitleFont = value; }
+            set
+            {
+                ps_.TitleFont = value;
+                ++dataVersion_;
+            }
         }
 
         /// <summary>
@@ -378,7 +437,11 @@ namespace NPlot.Windows
         public new int Padding
         {
             get { return ps_.Padding; }
-            set { ps_.Padding = value; }
+            set
+            {
+                ps_.Padding = value;
+                ++dataVersion_;
+            }
         }
 
         /// <summary>
@@ -441,7 +504,11 @@ namespace NPlot.Windows
         ]
         public Color PlotBackColor
         {
-            set { ps_.PlotBackColor = value; }
+            set
+            {
+                ps_.PlotBackColor = value;
+                ++dataVersion_;
+            }
         }
 
         /// <summary>
@@ -454,7 +521,11 @@ namespace NPlot.Windows
         ]
         public System.Drawing.Bitmap PlotBackImage
         {
-            set { ps_.PlotBackImage = value; }
+            set
+            {
+                ps_.PlotBackImage = value;
+                ++dataVersion_;
+            }
         }
 
         /// <summary>
@@ -467,7 +538,20 @@ namespace NPlot.Windows
         ]
         public IRectangleBrush PlotBackBrush
         {
-            set { ps_.PlotBackBrush = value; }
+            set
+            {
+                ps_.PlotBackBrush = value;
+                ++dataVersion_;
+            }
+        }
+
+        /// <summary>
+        /// Discards the kept plot background, so that it is drawn again. Needed only
+        /// if the PlotBackImage bitmap is modified in place.
+        /// </summary>
+        public void InvalidatePlotBackground()
+        {
+            ps_.InvalidatePlotBackground();
         }
 
         /// <summary>
@@ -480,7 +564,11 @@ namespace NPlot.Windows
         ]
         public Color TitleColor
         {
-            set { ps_.TitleColor = value; }
+            set
+            {
+                ps_.TitleColor = value;
+                ++dataVersion_;
+            }
         }
 
         /// <summary>
@@ -495,7 +583,11 @@ namespace NPlot.Windows
         public Brush TitleBrush
         {
             get { return ps_.TitleBrush; }
-            set { ps_.TitleBrush = value; }
+            set
+            {
+                ps_.TitleBrush = value;
+                ++dataVersion_;
+            }
         }
 
         /// <summary>
@@ -510,7 +602,126 @@ namespace NPlot.Windows
         public SmoothingMode SmoothingMode
         {
             get { return ps_.SmoothingMode; }
-            set { ps_.SmoothingMode = value; }
+            set
+            {
+                ps_.SmoothingMode = value;
+                ++dataVersion_;
+            }
+        }
+
+        /// <summary>
+        /// If true, the surface is drawn at preview quality while it is being dragged
+        /// or zoomed, and at full quality once it has been left alone for RefinementDelay
+        /// milliseconds.
+        /// </summary>
+        [
+            Category("PlotSurface2D"),
+            Description("Whether or not to draw a fast preview while the surface is being interacted with."),
+            Browsable(true),
+            Bindable(true)
+        ]
+        public bool ProgressiveRefinement { get; set; }
+
+        /// <summary>
+        /// The time in milliseconds after the last interaction before a
+        /// preview is replaced by a full quality drawing.
+        /// </summary>
+        [
+            Category("PlotSurface2D"),
+            Description("Milliseconds after the last interaction before the full quality drawing is made."),
+            Browsable(true),
+            Bindable(true)
+        ]
+        public int RefinementDelay
+        {
+            get { return refinementTimer_.Interval; }
+            set { refinementTimer_.Interval = value; }
+        }
+
+        /// <summary>
+        /// The size in pixels of the detail that may be left out of a preview.
+        /// </summary>
+        [
+            Category("PlotSurface2D"),
+            Description("Size in pixels of the detail that may be left out of a preview."),
+            Browsable(true),
+            Bindable(true)
+        ]
+        public int PreviewDecimation
+        {
+            get { return ps_.PreviewDecimation; }
+            set { ps_.PreviewDecimation = value; }
+        }
+
+        /// <summary>
+        /// Redraws the surface in response to an interaction, as a preview if
+        /// ProgressiveRefinement is on. Any full quality drawing already scheduled
+        /// is put off until the user has stopped again.
+        /// </summary>
+        private void RefreshInteractive()
+        {
+            if (linkGroup_ != null)
+            {
+                linkGroup_.RangeChanged(this, true);
+                return;
+            }
+            BeginPreview();
+            Refresh();
+        }
+
+        /// <summary>
+        /// If ProgressiveRefinement is on, makes the next paint a preview and
+        /// (re)starts the timer that will bring back the full quality drawing.
+        /// Other paints, eg after a resize, are always full quality.
+        /// </summary>
+        private void BeginPreview()
+        {
+            if (ProgressiveRefinement)
+            {
+                previewNext_ = true;
+                refinementTimer_.Stop();
+                refinementTimer_.Start();
+            }
+        }
+
+        /// <summary>
+        /// Called by the link group once the linked axes have been updated. Only
+        /// invalidates, so that all members of the group are painted together.
+        /// </summary>
+        /// <param name="interactive">true if the change came from an interaction in progress.</param>
+        internal void InvalidateLinked(bool interactive)
+        {
+            if (interactive)
+            {
+                BeginPreview();
+            }
+            Invalidate();
+        }
+
+        /// <summary>
+        /// The axis link group this surface is a member of, or null.
+        /// </summary>
+        [
+            Browsable(false)
+        ]
+        public AxisLinkGroup LinkGroup
+        {
+            get { return linkGroup_; }
+            internal set { linkGroup_ = value; }
+        }
+
+        /// <summary>
+        /// The user has stopped interacting, so make the full quality drawing.
+        /// </summary>
+        private void OnRefinementTimerTick(object sender, EventArgs e)
+        {
+            refinementTimer_.Stop();
+            zoomRecorded_ = false;
+            previewNext_ = false;
+            if (previewShown_)
+            {
+                Refresh();
+            }
         }
 
         /// <summary>
@@ -521,6 +732,7 @@ namespace NPlot.Windows
         public void AddAxesConstraint(AxesConstraint c)
         {
             ps_.AddAxesConstraint(c);
+            ++dataVersion_;
         }
 
         /// <summary>
@@ -531,6 +743,7 @@ namespace NPlot.Windows
         public void Remove(IDrawable p, bool updateAxes)
         {
             ps_.Remove(p, updateAxes);
+            ++dataVersion_;
         }
 
         /// <summary>
@@ -586,7 +799,57 @@ namespace NPlot.Windows
                 throw (new NPlotException("null border context"));
             }
 
-            Draw(g, border);
+            // the quality applies to this paint only.
+            bool preview = previewNext_;
+            previewNext_ = false;
+            previewShown_ = false;
+
+            // just navigated through the zoom history to a view we have an image of.
+            if (frame_ != null && frame_.Size == border.Size && frameVersion_ == dataVersion_)
+            {
+                g.DrawImageUnscaled(frame_, 0, 0);
+                return;
+            }
+
+            if (!preview)
+            {
+                Draw(g, border);
+                return;
+            }
+
+            ps_.Quality = DrawQuality.Preview;
+            try
+            {
+                Draw(g, border);
+                previewShown_ = true;
+            }
+            finally
+            {
+                ps_.Quality = DrawQuality.Full;
+            }
+        }
+
+        /// <summary>
+        /// Anything that invalidates the control means an image restored from the
+        /// zoom history may no longer be right.
+        /// </summary>
+        /// <param name="e">the event args.</param>
+        protected override void OnInvalidated(InvalidateEventArgs e)
+        {
+            DropFrame();
+            base.OnInvalidated(e);
+        }
+
+        /// <summary>
+        /// Forgets the image restored from the zoom history, if any.
+        /// </summary>
+        private void DropFrame()
+        {
+            if (frame_ != null)
+            {
+                frame_.Dispose();
+                frame_ = null;
+            }
         }
 
         /// <summary>
@@ -599,7 +862,6 @@ namespace NPlot.Windows
             bool dirty = false;
             foreach (Interactions.Interaction i in interactions_)
             {
-                i.DoMouseDown(e, this);
                 dirty |= i.DoMouseDown(e, this);
             }
             if (dirty)
@@ -619,12 +881,11 @@ namespace NPlot.Windows
             bool dirty = false;
             foreach (Interactions.Interaction i in interactions_)
             {
-                i.DoMouseMove(e, ctr, lastKeyEventArgs_);
                 dirty |= i.DoMouseMove(e, ctr, lastKeyEventArgs_);
             }
             if (dirty)
             {
-                Refresh();
+                RefreshInteractive();
             }
 
             // Update coordinates if necessary. 
@@ -646,6 +907,17 @@ namespace NPlot.Windows
                     double x = PhysicalXAxis1Cache.PhysicalToWorld(here, true);
                     double y = PhysicalYAxis1Cache.PhysicalToWorld(here, true);
                     string s = "";
+
+                    // snap to a data point if there is one close by.
+                    BaseSequencePlot plot = null;
+                    int index = -1;
+                    if (ToolTipPointRadius > 0 && ps_.NearestPoint(here, ToolTipPointRadius, out plot, out index))
+                    {
+                        PointD point = plot.PointIndex[index];
+                        x = point.X;
+                        y = point.Y;
+                    }
+
                     if (!DateTimeToolTip)
                     {
                         s = "(" + x.ToString("g4") + "," + y.ToString("g4") + ")";
@@ -655,6 +927,10 @@ namespace NPlot.Windows
                         DateTime dateTime = new DateTime((long) x);
                         s = dateTime.ToShortDateString() + " " + dateTime.ToLongTimeString() + Environment.NewLine + y.ToString("f4");
                     }
+                    if (plot != null)
+                    {
+                        s = plot.Label + " [" + index + "]" + Environment.NewLine + s;
+                    }
                     coordinates_.SetToolTip(this, s);
                 }
                 else
@@ -679,9 +955,26 @@ namespace NPlot.Windows
             {
                 dirty |= i.DoMouseUp(e, ctr);
             }
+            zoomRecorded_ = false;
             if (dirty)
             {
-                Refresh();
+                if (linkGroup_ != null)
+                {
+                    linkGroup_.RangeChanged(this, false);
+                }
+                else
+                {
+                    Refresh();
+                }
+            }
+
+            if (e.Button == MouseButtons.XButton1)
+            {
+                ZoomBack();
+            }
+            else if (e.Button == MouseButtons.XButton2)
+            {
+                ZoomForward();
             }
 
             if (e.Button == MouseButtons.Right)
@@ -702,6 +995,9 @@ namespace NPlot.Windows
         {
             components = new Container();
             coordinates_ = new ToolTip(components);
+            refinementTimer_ = new Timer(components);
+            refinementTimer_.Interval = 250;
+            refinementTimer_.Tick += OnRefinementTimerTick;
             // 
             // PlotSurface2D
             // 
@@ -795,12 +1091,11 @@ namespace NPlot.Windows
             bool dirty = false;
             foreach (Interactions.Interaction i in interactions_)
             {
-                i.DoMouseWheel(e, this);
                 dirty |= i.DoMouseWheel(e, this);
             }
             if (dirty)
             {
-                Refresh();
+                RefreshInteractive();
             }
         }
 
@@ -851,23 +1146,339 @@ namespace NPlot.Windows
         }
 
         /// <summary>
-        /// sets axes to be those saved in the cache.
+        /// Goes back to the axes as they were before the first interaction still
+        /// in the zoom history.
         /// </summary>
         public void OriginalDimensions()
         {
-            if (xAxis1ZoomCache_ != null)
+            ZoomHistory(0);
+        }
+
+        /// <summary>
+        /// Goes back to the axes as they were before the last interaction. If the view
+        /// has an image kept (see ZoomHistoryMemory) it is shown instead of drawing.
+        /// Changes made in place to what is drawn, such as to plotted data or to the
+        /// pens of plots, are not noticed unless DataChanged is called. The members of
+        /// an AxisLinkGroup record their views together, and go back together.
+        /// </summary>
+        public void ZoomBack()
+        {
+            ZoomHistory(-1);
+        }
+
+        /// <summary>
+        /// Undoes a ZoomBack.
+        /// </summary>
+        public void ZoomForward()
+        {
+            ZoomHistory(1);
+        }
+
+        /// <summary>
+        /// Moves through the zoom history of this surface, or of every member of its
+        /// link group.
+        /// </summary>
+        /// <param name="direction">-1 to go back a view, 1 to go forward a view, 0 to go back to the first view.</param>
+        private void ZoomHistory(int direction)
+        {
+            if (linkGroup_ != null)
             {
-                XAxis1 = xAxis1ZoomCache_;
-                XAxis2 = xAxis2ZoomCache_;
-                YAxis1 = yAxis1ZoomCache_;
-                YAxis2 = yAxis2ZoomCache_;
+                linkGroup_.ZoomHistory(this, direction);
+                return;
+            }
 
-                xAxis1ZoomCache_ = null;
-                xAxis2ZoomCache_ = null;
-                yAxis1ZoomCache_ = null;
-                yAxis2ZoomCache_ = null;
+            if (!StepZoomHistory(direction) && direction == 0)
+            {
+                Refresh();
             }
-            Refresh();
+        }
+
+        /// <summary>
+        /// Moves through the zoom history of this surface only. Called directly, or
+        /// for each member by the link group.
+        /// </summary>
+        /// <param name="direction">-1 to go back a view, 1 to go forward a view, 0 to go back to the first view.</param>
+        /// <returns>false if there was no view to go to.</returns>
+        internal bool StepZoomHistory(int direction)
+        {
+            ArrayList from = direction > 0 ? zoomForward_ : zoomBack_;
+            ArrayList to = direction > 0 ? zoomBack_ : zoomForward_;
+            if (from.Count == 0)
+            {
+                return false;
+            }
+            ZoomTo(from, to, direction == 0 ? from.Count : 1);
+            return true;
+        }
+
+        /// <summary>
+        /// True if there is a view to go back to.
+        /// </summary>
+        [
+            Browsable(false)
+        ]
+        public bool CanZoomBack
+        {
+            get { return zoomBack_.Count > 0; }
+        }
+
+        /// <summary>
+        /// True if there is a view to go forward to.
+        /// </summary>
+        [
+            Browsable(false)
+        ]
+        public bool CanZoomForward
+        {
+            get { return zoomForward_.Count > 0; }
+        }
+
+        /// <summary>
+        /// The maximum number of views kept in the zoom history (back and forward
+        /// together). The view from before the first interaction is always kept.
+        /// </summary>
+        [
+            Category("PlotSurface2D"),
+            Description("Maximum number of views kept in the zoom history."),
+            Browsable(true),
+            Bindable(true)
+        ]
+        public int ZoomHistoryLength
+        {
+            get { return zoomHistoryLength_; }
+            set
+            {
+                if (value < 1)
+                {
+                    throw new NPlotException("ZoomHistoryLength must be at least 1.");
+                }
+                zoomHistoryLength_ = value;
+                TrimZoomHistory();
+            }
+        }
+
+        /// <summary>
+        /// The maximum number of bytes of images kept with views in the zoom history,
+        /// 32MB by default (a few full screen views). The view is drawn into an image
+        /// when an interaction starts, and going back or forward to a view that still
+        /// has its image just draws the image, if it is the right size and nothing
+        /// drawn has changed since. The images furthest from the current view are
+        /// dropped first. Zero keeps no images.
+        /// </summary>
+        [
+            Category("PlotSurface2D"),
+            Description("Maximum number of bytes of images kept in the zoom history."),
+            Browsable(true),
+            Bindable(true)
+        ]
+        public long ZoomHistoryMemory
+        {
+            get { return zoomHistoryMemory_; }
+            set
+            {
+                zoomHistoryMemory_ = Math.Max(0, value);
+                TrimZoomHistory();
+            }
+        }
+
+        /// <summary>
+        /// Tells the control that something drawn has been changed in place, for
+        /// example plotted data or the pen of a plot, so that images in the zoom
+        /// history are not used. Adding or removing drawables and setting the
+        /// properties of the control do this automatically.
+        /// </summary>
+        public void DataChanged()
+        {
+            ++dataVersion_;
+        }
+
+        /// <summary>
+        /// A view in the zoom history: the axes, and optionally an image of the
+        /// drawing of them along with the layout it was drawn with.
+        /// </summary>
+        private class ZoomState
+        {
+            public Axis XAxis1;
+            public Axis XAxis2;
+            public Axis YAxis1;
+            public Axis YAxis2;
+
+            public System.Drawing.Bitmap Frame;
+            public object Layout;
+            public long DataVersion;
+
+            public long FrameBytes
+            {
+                get { return Frame == null ? 0 : 4L*Frame.Width*Frame.Height; }
+            }
+
+            public void DropFrame()
+            {
+                if (Frame != null)
+                {
+                    Frame.Dispose();
+                    Frame = null;
+                }
+                Layout = null;
+            }
+        }
+
+        /// <summary>
+        /// Takes the current view. If images are kept, an image restored from the
+        /// history that still shows it goes with it, or else if render is true the
+        /// view is drawn into a new one.
+        /// </summary>
+        private ZoomState CaptureZoomState(bool render)
+        {
+            ZoomState s = new ZoomState();
+            s.XAxis1 = XAxis1 == null ? null : (Axis) XAxis1.Clone();
+            s.XAxis2 = XAxis2 == null ? null : (Axis) XAxis2.Clone();
+            s.YAxis1 = YAxis1 == null ? null : (Axis) YAxis1.Clone();
+            s.YAxis2 = YAxis2 == null ? null : (Axis) YAxis2.Clone();
+
+            if (zoomHistoryMemory_ <= 0)
+            {
+                return s;
+            }
+
+            if (frame_ != null && frameVersion_ == dataVersion_)
+            {
+                s.Frame = frame_;
+                frame_ = null;
+            }
+            else if (render && Width > 0 && Height > 0 && 4L*Width*Height <= zoomHistoryMemory_)
+            {
+                s.Frame = new System.Drawing.Bitmap(Width, Height, PixelFormat.Format32bppPArgb);
+                using (Graphics g = Graphics.FromImage(s.Frame))
+                {
+                    g.Clear(BackColor);
+                    Draw(g, new Rectangle(0, 0, Width, Height));
+                }
+            }
+
+            if (s.Frame != null)
+            {
+                s.Layout = ps_.SaveLayout();
+                s.DataVersion = dataVersion_;
+            }
+            return s;
+        }
+
+        /// <summary>
+        /// Moves steps views through the history from one stack to the other,
+        /// pushing the current view, and shows the view arrived at.
+        /// </summary>
+        private void ZoomTo(ArrayList from, ArrayList to, int steps)
+        {
+            // the view being left is only kept with an image if it already has one.
+            to.Add(CaptureZoomState(false));
+            for (int i = 1; i < steps; ++i)
+            {
+                to.Add(from[from.Count - 1]);
+                from.RemoveAt(from.Count - 1);
+            }
+            ZoomState s = (ZoomState) from[from.Count - 1];
+            from.RemoveAt(from.Count - 1);
+
+            // the state is no longer in the history, so its axes can be used directly.
+            XAxis1 = s.XAxis1;
+            XAxis2 = s.XAxis2;
+            YAxis1 = s.YAxis1;
+            YAxis2 = s.YAxis2;
+            zoomRecorded_ = false;
+
+            refinementTimer_.Stop();
+            previewNext_ = false;
+
+            if (s.Frame != null && s.Layout != null &&
+                s.Frame.Size == Size && s.DataVersion == dataVersion_)
+            {
+                ps_.RestoreLayout(s.Layout);
+
+                // Invalidate drops any image, so set it after.
+                Invalidate();
+                frame_ = s.Frame;
+                frameVersion_ = s.DataVersion;
+            }
+            else
+            {
+                s.DropFrame();
+
+                // members of a link group are painted together.
+                if (linkGroup_ != null)
+                {
+                    Invalidate();
+                }
+                else
+                {
+                    Refresh();
+                }
+            }
+
+            TrimZoomHistory();
+        }
+
+        /// <summary>
+        /// Keeps the zoom history within ZoomHistoryLength views, then within
+        /// ZoomHistoryMemory bytes of images.
+        /// </summary>
+        private void TrimZoomHistory()
+        {
+            while (zoomBack_.Count + zoomForward_.Count > zoomHistoryLength_)
+            {
+                // keep the original view at the bottom of the back stack.
+                ArrayList stack = zoomBack_.Count > 1 ? zoomBack_ : zoomForward_;
+                int index = stack == zoomBack_ ? 1 : 0;
+                ((ZoomState) stack[index]).DropFrame();
+                stack.RemoveAt(index);
+            }
+
+            long bytes = 0;
+            foreach (ZoomState s in zoomBack_)
+            {
+                bytes += s.FrameBytes;
+            }
+            foreach (ZoomState s in zoomForward_)
+            {
+                bytes += s.FrameBytes;
+            }
+
+            // drop images furthest from the current view first. Index 0 of each
+            // stack is the furthest from it.
+            int b = 0;
+            int f = 0;
+            while (bytes > zoomHistoryMemory_ && (b < zoomBack_.Count || f < zoomForward_.Count))
+            {
+                ZoomState s;
+                if (f >= zoomForward_.Count || (b < zoomBack_.Count && zoomBack_.Count - b >= zoomForward_.Count - f))
+                {
+                    s = (ZoomState) zoomBack_[b++];
+                }
+                else
+                {
+                    s = (ZoomState) zoomForward_[f++];
+                }
+                bytes -= s.FrameBytes;
+                s.DropFrame();
+            }
+        }
+
+        /// <summary>
+        /// Forgets all views in the zoom history.
+        /// </summary>
+        private void ClearZoomHistory()
+        {
+            foreach (ZoomState s in zoomBack_)
+            {
+                s.DropFrame();
+            }
+            foreach (ZoomState s in zoomForward_)
+            {
+                s.DropFrame();
+            }
+            zoomBack_.Clear();
+            zoomForward_.Clear();
+            zoomRecorded_ = false;
         }
 
         private void DrawHorizontalSelection(Point start, Point end, UserControl ctr)
@@ -973,30 +1584,44 @@ namespace NPlot.Windows
         }
 
         /// <summary>
-        /// Remembers the current axes - useful in interactions.
+        /// Remembers the current axes - useful in interactions. Only the first call
+        /// in a gesture adds a view to the zoom history; a gesture ends when a mouse
+        /// button is released or, with ProgressiveRefinement, when the full quality
+        /// drawing is made. Any views to go forward to are forgotten. Every member
+        /// of a link group records its view.
         /// </summary>
         public void CacheAxes()
         {
-            if (xAxis1ZoomCache_ == null && xAxis2ZoomCache_ == null &&
-                yAxis1ZoomCache_ == null && yAxis2ZoomCache_ == null)
+            if (zoomRecorded_)
             {
-                if (XAxis1 != null)
-                {
-                    xAxis1ZoomCache_ = (Axis) XAxis1.Clone();
-                }
-                if (XAxis2 != null)
-                {
-                    xAxis2ZoomCache_ = (Axis) XAxis2.Clone();
-                }
-                if (YAxis1 != null)
-                {
-                    yAxis1ZoomCache_ = (Axis) YAxis1.Clone();
-                }
-                if (YAxis2 != null)
-                {
-                    yAxis2ZoomCache_ = (Axis) YAxis2.Clone();
-                }
+                return;
             }
+            zoomRecorded_ = true;
+
+            if (linkGroup_ != null)
+            {
+                linkGroup_.RecordZoom();
+            }
+            else
+            {
+                RecordZoom();
+            }
+        }
+
+        /// <summary>
+        /// Adds the current view of this surface to its zoom history. Called directly,
+        /// or for each member by the link group.
+        /// </summary>
+        internal void RecordZoom()
+        {
+            foreach (ZoomState s in zoomForward_)
+            {
+                s.DropFrame();
+            }
+            zoomForward_.Clear();
+
+            zoomBack_.Add(CaptureZoomState(true));
+            TrimZoomHistory();
         }
 
         /// <summary>
@@ -1056,6 +1681,8 @@ namespace NPlot.Windows
             {
                 if (components != null)
                     components.Dispose();
+                ClearZoomHistory();
+                DropFrame();
             }
             base.Dispose(disposing);
         }
@@ -1242,7 +1869,7 @@ namespace NPlot.Windows
                 /// <param name="plotContextMenu">The plot menu this item is a member of.</param>
                 public override void OnPopup(PlotContextMenu plotContextMenu)
                 {
-                    MenuItem.Enabled = plotContextMenu.plotSurface2D_.xAxis1ZoomCache_ != null;
+                    MenuItem.Enabled = plotContextMenu.plotSurface2D_.CanZoomBack;
                 }
             }
 
@@ -0,0 +1,115 @@
+/*
+ * NPlot - A charting library for .NET
+ * 
+ * FrameExporterTest.cs
+ * Copyright (C) 2003-2006 Matt Howlett and others.
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+using System;
+using System.Drawing;
+using System.Drawing.Imaging;
+using System.IO;
+using NPlot.Bitmap;
+using NUnit.Framework;
+
+namespace NPlotTest
+{
+    /// <summary>
+    /// Checks that FrameExporter writes every frame, in order, with the state the
+    /// setup callback gave the surface for it, however the encoding is spread
+    /// over threads.
+    /// </summary>
+    [TestFixture]
+    public class FrameExporterTest
+    {
+        private const int frames_ = 25;
+
+        private static void Setup(PlotSurface2D surface, int frame)
+        {
+            surface.BackColor = Color.FromArgb(frame*10, 0, 0);
+        }
+
+        private static FrameExporter Make()
+        {
+            FrameExporter exporter = new FrameExporter(new PlotSurface2D(40, 30));
+            exporter.Encoders = 3;
+            exporter.PoolSize = 4;
+            exporter.ImageFormat = ImageFormat.Bmp;
+            return exporter;
+        }
+
+        private static int FrameOf(Stream image)
+        {
+            using (System.Drawing.Bitmap b = new System.Drawing.Bitmap(image))
+            {
+                return b.GetPixel(0, 0).R/10;
+            }
+        }
+
+        [Test]
+        public void StreamedFramesAreInOrder()
+        {
+            MemoryStream stream = new MemoryStream();
+            Make().Export(frames_, Setup, stream);
+
+            // each BMP image starts with "BM" followed by its length in bytes.
+            byte[] data = stream.ToArray();
+            int position = 0;
+            for (int i = 0; i < frames_; ++i)
+            {
+                Assert.IsTrue(position + 6 <= data.Length, "frame " + i + " is missing");
+                Assert.AreEqual((byte) 'B', data[position]);
+                Assert.AreEqual((byte) 'M', data[position + 1]);
+                int length = BitConverter.ToInt32(data, position + 2);
+                Assert.AreEqual(i, FrameOf(new MemoryStream(data, position, length)));
+                position += length;
+            }
+            Assert.AreEqual(data.Length, position);
+        }
+
+        [Test]
+        public void FilesAreNamedByFrame()
+        {
+            string directory = Path.Combine(Path.GetTempPath(), Path.GetRandomFileName());
+            Directory.CreateDirectory(directory);
+            try
+            {
+                Make().Export(frames_, Setup, Path.Combine(directory, "frame{0:000}.bmp"));
+
+                Assert.AreEqual(frames_, Directory.GetFiles(directory).Length);
+                for (int i = 0; i < frames_; ++i)
+                {
+                    using (Stream file = File.OpenRead(Path.Combine(directory, String.Format("frame{0:000}.bmp", i))))
+                    {
+                        Assert.AreEqual(i, FrameOf(file));
+                    }
+                }
+            }
+            finally
+            {
+                Directory.Delete(directory, true);
+            }
+        }
+    }
+}
\ No newline at end of file
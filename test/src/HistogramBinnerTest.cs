@@ -0,0 +1,190 @@
+/*
+ * NPlot - A charting library for .NET
+ * 
+ * HistogramBinnerTest.cs
+ * Copyright (C) 2003-2006 Matt Howlett and others.
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+using System;
+using System.IO;
+using NPlot;
+using NUnit.Framework;
+
+namespace NPlotTest
+{
+    /// <summary>
+    /// Checks that the bars of a HistogramBinner agree with counting the samples
+    /// directly, however the view is set and however the samples are added.
+    /// </summary>
+    [TestFixture]
+    public class HistogramBinnerTest
+    {
+        private static double[] Uniform(int count, double min, double max, int seed)
+        {
+            Random r = new Random(seed);
+            double[] samples = new double[count];
+            for (int i = 0; i < count; ++i)
+            {
+                samples[i] = min + r.NextDouble()*(max - min);
+            }
+            return samples;
+        }
+
+        private static double Sum(double[] values)
+        {
+            double sum = 0.0;
+            foreach (double v in values)
+            {
+                sum += v;
+            }
+            return sum;
+        }
+
+        [Test]
+        public void BarsOnBaseBinBoundariesAreExact()
+        {
+            // the range is chosen so that the bin boundaries are not exact in binary.
+            HistogramBinner binner = new HistogramBinner(0.1, 0.7, 600, 6);
+            double[] samples = Uniform(20000, 0.1, 0.7, 1);
+            binner.Add(samples);
+
+            double scale = 600/(0.7 - 0.1);
+            double[] expected = new double[6];
+            double[] zoomed = new double[3];
+            foreach (double v in samples)
+            {
+                int b = Math.Min((int) ((v - 0.1)*scale), 599);
+                expected[b/100] += 1.0;
+                if (b >= 150 && b < 450)
+                    zoomed[(b - 150)/100] += 1.0;
+            }
+
+            double[] counts = binner.Counts;
+            for (int i = 0; i < expected.Length; ++i)
+            {
+                Assert.AreEqual(expected[i], counts[i], 0.0, "bar " + i);
+            }
+
+            binner.SetView(0.25, 0.55, 3);
+            counts = binner.Counts;
+            for (int i = 0; i < zoomed.Length; ++i)
+            {
+                Assert.AreEqual(zoomed[i], counts[i], 0.0, "zoomed bar " + i);
+            }
+        }
+
+        [Test]
+        public void BaseBinsAreSharedInProportion()
+        {
+            HistogramBinner binner = new HistogramBinner(0.0, 2.0, 2, 2);
+            binner.Add(new double[] {0.5, 0.5, 0.5, 0.5, 1.5, 1.5});
+
+            binner.SetView(0.0, 2.0, 4);
+            double[] counts = binner.Counts;
+            Assert.AreEqual(2.0, counts[0], 1e-12);
+            Assert.AreEqual(2.0, counts[1], 1e-12);
+            Assert.AreEqual(1.0, counts[2], 1e-12);
+            Assert.AreEqual(1.0, counts[3], 1e-12);
+
+            binner.SetView(0.5, 1.5, 1);
+            Assert.AreEqual(3.0, binner.Counts[0], 1e-12);
+        }
+
+        [Test]
+        public void RebinningKeepsTheTotal()
+        {
+            HistogramBinner binner = new HistogramBinner(-3.0, 3.0, 1000, 10);
+            binner.Add(Uniform(50000, -3.0, 3.0, 2));
+
+            foreach (int bins in new int[] {1, 3, 7, 10, 333, 1000, 2500})
+            {
+                binner.SetView(-3.0, 3.0, bins);
+                Assert.AreEqual(bins, binner.Counts.Length);
+                Assert.AreEqual(50000.0, Sum(binner.Counts), 1e-6, bins + " bins");
+            }
+        }
+
+        [Test]
+        public void SamplesOutsideTheRangeAreCountedSeparately()
+        {
+            HistogramBinner binner = new HistogramBinner(0.0, 1.0, 10, 10);
+            binner.Add(new double[] {-0.5, 0.0, 1.0, 1.5, 2.0, double.NaN});
+
+            Assert.AreEqual(1L, binner.Underflow);
+            Assert.AreEqual(2L, binner.Overflow);
+            Assert.AreEqual(1.0, binner.Counts[0], 0.0);
+            Assert.AreEqual(1.0, binner.Counts[9], 0.0);
+            Assert.AreEqual(2.0, Sum(binner.Counts), 0.0);
+
+            binner.Clear();
+            Assert.AreEqual(0L, binner.Underflow);
+            Assert.AreEqual(0.0, Sum(binner.Counts), 0.0);
+        }
+
+        [Test]
+        public void ThreadedFileAndStreamBinningAgree()
+        {
+            double[] samples = Uniform(300000, -1.0, 11.0, 3);
+
+            HistogramBinner single = new HistogramBinner(0.0, 10.0, 500, 500);
+            single.Threads = 1;
+            single.Add(samples);
+
+            HistogramBinner threaded = new HistogramBinner(0.0, 10.0, 500, 500);
+            threaded.Threads = 4;
+            threaded.Add(samples);
+
+            byte[] bytes = new byte[samples.Length*8];
+            Buffer.BlockCopy(samples, 0, bytes, 0, bytes.Length);
+
+            HistogramBinner streamed = new HistogramBinner(0.0, 10.0, 500, 500);
+            streamed.Add(new MemoryStream(bytes));
+
+            HistogramBinner mapped = new HistogramBinner(0.0, 10.0, 500, 500);
+            mapped.Threads = 4;
+            string path = Path.GetTempFileName();
+            try
+            {
+                File.WriteAllBytes(path, bytes);
+                mapped.AddFile(path);
+            }
+            finally
+            {
+                File.Delete(path);
+            }
+
+            foreach (HistogramBinner other in new HistogramBinner[] {threaded, streamed, mapped})
+            {
+                Assert.AreEqual(single.Underflow, other.Underflow);
+                Assert.AreEqual(single.Overflow, other.Overflow);
+                double[] expected = single.Counts;
+                double[] counts = other.Counts;
+                for (int i = 0; i < expected.Length; ++i)
+                {
+                    Assert.AreEqual(expected[i], counts[i], 0.0, "bar " + i);
+                }
+            }
+        }
+    }
+}
\ No newline at end of file
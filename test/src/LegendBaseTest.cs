@@ -0,0 +1,134 @@
+/*
+ * NPlot - A charting library for .NET
+ * 
+ * LegendBaseTest.cs
+ * Copyright (C) 2003-2006 Matt Howlett and others.
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+using System.Collections;
+using System.Drawing;
+using NPlot;
+using NUnit.Framework;
+
+namespace NPlotTest
+{
+    /// <summary>
+    /// Checks that the layout LegendBase keeps between draws is worked out again
+    /// whenever something it depends on changes.
+    /// </summary>
+    [TestFixture]
+    public class LegendBaseTest
+    {
+        private static ArrayList Plots(params string[] labels)
+        {
+            ArrayList plots = new ArrayList();
+            foreach (string label in labels)
+            {
+                LinePlot p = new LinePlot();
+                p.Label = label;
+                plots.Add(p);
+            }
+            return plots;
+        }
+
+        private static Rectangle Box(LegendBase legend, ArrayList plots, float scale)
+        {
+            return legend.GetBoundingBox(new Point(0, 0), plots, scale);
+        }
+
+        [Test]
+        public void LayoutIsKeptWhileNothingChanges()
+        {
+            LegendBase legend = new LegendBase();
+            ArrayList plots = Plots("one", "two");
+            Assert.AreEqual(Box(legend, plots, 1.0f), Box(legend, plots, 1.0f));
+            Assert.AreEqual(Box(legend, plots, 1.0f), Box(new LegendBase(), Plots("one", "two"), 1.0f));
+        }
+
+        [Test]
+        public void ChangingALabelChangesTheLayout()
+        {
+            LegendBase legend = new LegendBase();
+            ArrayList plots = Plots("one", "two");
+            Rectangle before = Box(legend, plots, 1.0f);
+
+            ((LinePlot) plots[1]).Label = "a much longer label than before";
+            Assert.IsTrue(Box(legend, plots, 1.0f).Width > before.Width);
+        }
+
+        [Test]
+        public void ChangingThePlotsChangesTheLayout()
+        {
+            LegendBase legend = new LegendBase();
+            ArrayList plots = Plots("one", "two");
+            Rectangle before = Box(legend, plots, 1.0f);
+
+            plots.AddRange(Plots("three"));
+            Rectangle added = Box(legend, plots, 1.0f);
+            Assert.IsTrue(added.Height > before.Height);
+
+            ((LinePlot) plots[2]).ShowInLegend = false;
+            Assert.AreEqual(before, Box(legend, plots, 1.0f));
+        }
+
+        [Test]
+        public void ChangingTheFontChangesTheLayout()
+        {
+            LegendBase legend = new LegendBase();
+            ArrayList plots = Plots("one", "two");
+            Rectangle before = Box(legend, plots, 1.0f);
+
+            legend.Font = new Font(FontFamily.GenericSansSerif, 30.0f, FontStyle.Regular, GraphicsUnit.Pixel);
+            Assert.IsTrue(Box(legend, plots, 1.0f).Height > before.Height);
+        }
+
+        [Test]
+        public void ChangingTheArrangementChangesTheLayout()
+        {
+            LegendBase legend = new LegendBase();
+            ArrayList plots = Plots("one", "two", "three", "four");
+            Rectangle column = Box(legend, plots, 1.0f);
+
+            legend.NumberItemsHorizontally = 4;
+            Rectangle row = Box(legend, plots, 1.0f);
+            Assert.IsTrue(row.Width > column.Width);
+            Assert.IsTrue(row.Height < column.Height);
+        }
+
+        [Test]
+        public void ChangingTheScaleChangesAutoScaledText()
+        {
+            LegendBase legend = new LegendBase();
+            ArrayList plots = Plots("one", "two");
+            Rectangle before = Box(legend, plots, 1.0f);
+
+            // the spacing is scaled whether or not the text is.
+            Rectangle scaled = Box(legend, plots, 2.0f);
+            Assert.IsTrue(scaled.Height > before.Height);
+
+            legend.AutoScaleText = true;
+            Assert.IsTrue(Box(legend, plots, 2.0f).Height > scaled.Height);
+        }
+    }
+}
\ No newline at end of file
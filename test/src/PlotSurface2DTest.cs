@@ -0,0 +1,83 @@
+/*
+ * NPlot - A charting library for .NET
+ * 
+ * PlotSurface2DTest.cs
+ * Copyright (C) 2003-2006 Matt Howlett and others.
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+using NPlot;
+using NUnit.Framework;
+
+namespace NPlotTest
+{
+    /// <summary>
+    /// Checks the axes PlotSurface2D works out from the plots added to it, and
+    /// that ReferencePath turns off keeping them.
+    /// </summary>
+    [TestFixture]
+    public class PlotSurface2DTest
+    {
+        /// <summary>
+        /// Adds a plot of y and another plot, changes y in place and removes the
+        /// other plot, which updates the axes.
+        /// </summary>
+        private static PlotSurface2D ChangeDataThenUpdateAxes(bool referencePath)
+        {
+            PlotSurface2D ps = new PlotSurface2D();
+            ps.ReferencePath = referencePath;
+
+            double[] y = {1.0, 2.0, 3.0};
+            ps.Add(new LinePlot(y));
+            LinePlot other = new LinePlot(new double[] {0.0, 1.0});
+            ps.Add(other);
+
+            y[2] = 30.0;
+            ps.Remove(other, true);
+            return ps;
+        }
+
+        [Test]
+        public void SuggestedAxesAreKept()
+        {
+            PlotSurface2D ps = ChangeDataThenUpdateAxes(false);
+            Assert.IsTrue(ps.YAxis1.WorldMax < 30.0);
+        }
+
+        [Test]
+        public void ReferencePathSuggestsAxesAgain()
+        {
+            PlotSurface2D ps = ChangeDataThenUpdateAxes(true);
+            Assert.IsTrue(ps.YAxis1.WorldMax >= 30.0);
+        }
+
+        [Test]
+        public void ReferencePathIsNotResetByClear()
+        {
+            PlotSurface2D ps = new PlotSurface2D();
+            ps.ReferencePath = true;
+            ps.Clear();
+            Assert.IsTrue(ps.ReferencePath);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,241 @@
+/*
+ * NPlot - A charting library for .NET
+ * 
+ * RollingIndicatorTest.cs
+ * Copyright (C) 2003-2006 Matt Howlett and others.
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+using System;
+using System.Collections;
+using NPlot;
+using NUnit.Framework;
+
+namespace NPlotTest
+{
+    /// <summary>
+    /// Checks the incremental calculations of RollingIndicator against direct
+    /// calculation over each window.
+    /// </summary>
+    [TestFixture]
+    public class RollingIndicatorTest
+    {
+        private static readonly RollingIndicator.IndicatorType[] windowed_ =
+            {
+                RollingIndicator.IndicatorType.Sma,
+                RollingIndicator.IndicatorType.StdDev,
+                RollingIndicator.IndicatorType.Min,
+                RollingIndicator.IndicatorType.Max,
+                RollingIndicator.IndicatorType.UpperBand,
+                RollingIndicator.IndicatorType.LowerBand
+            };
+
+        private static double[] RandomWalk(int count, int seed)
+        {
+            Random r = new Random(seed);
+            double[] data = new double[count];
+            double v = 100.0;
+            for (int i = 0; i < count; ++i)
+            {
+                v += r.NextDouble() - 0.5;
+                data[i] = v;
+            }
+            return data;
+        }
+
+        /// <summary>
+        /// The value of the indicator for the window ending at i, worked out directly.
+        /// </summary>
+        private static double Direct(RollingIndicator.IndicatorType type, double[] data, int period, int i)
+        {
+            if (i < period - 1)
+                return double.NaN;
+
+            double sum = 0.0;
+            double min = double.MaxValue;
+            double max = double.MinValue;
+            for (int k = i - period + 1; k <= i; ++k)
+            {
+                if (double.IsNaN(data[k]))
+                    return double.NaN;
+                sum += data[k];
+                min = Math.Min(min, data[k]);
+                max = Math.Max(max, data[k]);
+            }
+            double mean = sum/period;
+
+            double m2 = 0.0;
+            for (int k = i - period + 1; k <= i; ++k)
+            {
+                m2 += (data[k] - mean)*(data[k] - mean);
+            }
+            double sd = Math.Sqrt(m2/period);
+
+            switch (type)
+            {
+                case RollingIndicator.IndicatorType.Sma:
+                    return mean;
+                case RollingIndicator.IndicatorType.StdDev:
+                    return sd;
+                case RollingIndicator.IndicatorType.Min:
+                    return min;
+                case RollingIndicator.IndicatorType.Max:
+                    return max;
+                case RollingIndicator.IndicatorType.UpperBand:
+                    return mean + 2.0*sd;
+                default:
+                    return mean - 2.0*sd;
+            }
+        }
+
+        private static RollingIndicator Make(RollingIndicator.IndicatorType type, int period, object data)
+        {
+            RollingIndicator indicator = new RollingIndicator(type, period, data);
+            indicator.Update();
+            return indicator;
+        }
+
+        [Test]
+        public void MatchesDirectCalculation()
+        {
+            double[] data = RandomWalk(500, 1);
+            foreach (RollingIndicator.IndicatorType type in windowed_)
+            {
+                foreach (int period in new int[] {1, 2, 7, 50})
+                {
+                    RollingIndicator indicator = Make(type, period, data);
+                    Assert.AreEqual(data.Length, indicator.Count);
+                    for (int i = 0; i < data.Length; ++i)
+                    {
+                        Assert.AreEqual(Direct(type, data, period, i), indicator[i], 1e-9, type + " " + period + " at " + i);
+                    }
+                }
+            }
+        }
+
+        [Test]
+        public void OrderOfAccessDoesNotMatter()
+        {
+            double[] data = RandomWalk(300, 2);
+            foreach (RollingIndicator.IndicatorType type in windowed_)
+            {
+                RollingIndicator forward = Make(type, 20, data);
+                RollingIndicator backward = Make(type, 20, data);
+                RollingIndicator scattered = Make(type, 20, data);
+
+                double[] expected = new double[data.Length];
+                for (int i = 0; i < data.Length; ++i)
+                {
+                    expected[i] = forward[i];
+                }
+                for (int i = data.Length - 1; i >= 0; --i)
+                {
+                    Assert.AreEqual(expected[i], backward[i], 1e-9, type + " backward at " + i);
+                }
+                Random r = new Random(3);
+                for (int n = 0; n < 1000; ++n)
+                {
+                    int i = r.Next(data.Length);
+                    Assert.AreEqual(expected[i], scattered[i], 1e-9, type + " scattered at " + i);
+                }
+            }
+        }
+
+        [Test]
+        public void NaNSpoilsEachWindowContainingIt()
+        {
+            double[] data = RandomWalk(100, 4);
+            data[40] = double.NaN;
+            foreach (RollingIndicator.IndicatorType type in windowed_)
+            {
+                RollingIndicator indicator = Make(type, 10, data);
+                for (int i = 0; i < data.Length; ++i)
+                {
+                    if (i >= 40 && i < 50)
+                        Assert.IsNaN(indicator[i], type + " at " + i);
+                    else
+                        Assert.AreEqual(Direct(type, data, 10, i), indicator[i], 1e-9, type + " at " + i);
+                }
+            }
+        }
+
+        [Test]
+        public void AppendedValuesAreIncluded()
+        {
+            double[] data = RandomWalk(200, 5);
+            ArrayList source = new ArrayList();
+            for (int i = 0; i < 120; ++i)
+            {
+                source.Add(data[i]);
+            }
+
+            RollingIndicator indicator = Make(RollingIndicator.IndicatorType.Sma, 15, source);
+            double before = indicator[119];
+
+            for (int i = 120; i < data.Length; ++i)
+            {
+                source.Add(data[i]);
+            }
+            Assert.AreEqual(120, indicator.Count);
+            indicator.Update();
+            Assert.AreEqual(data.Length, indicator.Count);
+
+            Assert.AreEqual(before, indicator[119], 0.0);
+            for (int i = 0; i < data.Length; ++i)
+            {
+                Assert.AreEqual(Direct(RollingIndicator.IndicatorType.Sma, data, 15, i), indicator[i], 1e-9, "at " + i);
+            }
+        }
+
+        [Test]
+        public void EmaStartsFromSimpleAverage()
+        {
+            double[] data = {1.0, 2.0, 3.0, 4.0, 5.0, double.NaN, 6.0};
+            RollingIndicator indicator = Make(RollingIndicator.IndicatorType.Ema, 3, data);
+
+            Assert.IsNaN(indicator[0]);
+            Assert.IsNaN(indicator[1]);
+            Assert.AreEqual(2.0, indicator[2], 1e-12);
+            Assert.AreEqual(3.0, indicator[3], 1e-12);
+            Assert.AreEqual(4.0, indicator[4], 1e-12);
+            // NaN is skipped, leaving the average where it was.
+            Assert.AreEqual(4.0, indicator[5], 1e-12);
+            Assert.AreEqual(5.0, indicator[6], 1e-12);
+        }
+
+        [Test]
+        public void VwapWeightsByVolume()
+        {
+            double[] price = {10.0, 20.0, 30.0, 40.0};
+            double[] volume = {1.0, 3.0, 0.0, 1.0};
+            RollingIndicator indicator = new RollingIndicator(RollingIndicator.IndicatorType.Vwap, 2, price);
+            indicator.VolumeData = volume;
+            indicator.Update();
+
+            Assert.IsNaN(indicator[0]);
+            Assert.AreEqual(17.5, indicator[1], 1e-12);
+            Assert.AreEqual(20.0, indicator[2], 1e-12);
+            Assert.AreEqual(40.0, indicator[3], 1e-12);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,177 @@
+/*
+ * NPlot - A charting library for .NET
+ * 
+ * TradingDateTimeAxisTest.cs
+ * Copyright (C) 2003-2006 Matt Howlett and others.
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+using System;
+using System.Drawing;
+using NPlot;
+using NUnit.Framework;
+
+namespace NPlotTest
+{
+    /// <summary>
+    /// Checks that TradingDateTimeAxis collapses weekends, holidays and the time
+    /// outside trading hours, and that its transforms are consistent.
+    /// </summary>
+    [TestFixture]
+    public class TradingDateTimeAxisTest
+    {
+        // Friday 3 January 2020, and the days after it.
+        private static readonly DateTime friday_ = new DateTime(2020, 1, 3);
+        private static readonly DateTime monday_ = new DateTime(2020, 1, 6);
+        private static readonly DateTime tuesday_ = new DateTime(2020, 1, 7);
+        private static readonly DateTime wednesday_ = new DateTime(2020, 1, 8);
+
+        private static readonly PointF physicalMin_ = new PointF(0.0f, 0.0f);
+        private static readonly PointF physicalMax_ = new PointF(200.0f, 0.0f);
+
+        private static TradingDateTimeAxis Make(DateTime min, DateTime max)
+        {
+            TradingDateTimeAxis axis = new TradingDateTimeAxis();
+            axis.WorldMin = min.Ticks;
+            axis.WorldMax = max.Ticks;
+            return axis;
+        }
+
+        private static float X(TradingDateTimeAxis axis, DateTime t)
+        {
+            return axis.WorldToPhysical(t.Ticks, physicalMin_, physicalMax_, false).X;
+        }
+
+        [Test]
+        public void WeekendsAreCollapsed()
+        {
+            TradingDateTimeAxis axis = Make(friday_, tuesday_);
+            Assert.AreEqual((double) (2*TimeSpan.TicksPerDay), axis.SparseWorldLength, 0.0);
+
+            Assert.AreEqual(50.0, X(axis, friday_.AddHours(12)), 1e-3);
+            Assert.AreEqual(100.0, X(axis, friday_.AddDays(1).AddHours(12)), 1e-3);
+            Assert.AreEqual(100.0, X(axis, friday_.AddDays(2)), 1e-3);
+            Assert.AreEqual(100.0, X(axis, monday_), 1e-3);
+            Assert.AreEqual(150.0, X(axis, monday_.AddHours(12)), 1e-3);
+        }
+
+        [Test]
+        public void HolidaysAreCollapsed()
+        {
+            TradingDateTimeAxis axis = Make(friday_, tuesday_);
+            axis.Holidays = new DateTime[] {monday_.AddHours(15)};
+            Assert.AreEqual((double) TimeSpan.TicksPerDay, axis.SparseWorldLength, 0.0);
+            Assert.IsFalse(axis.OnTradingDays(monday_.AddHours(12).Ticks));
+
+            Assert.AreEqual(100.0, X(axis, friday_.AddHours(12)), 1e-3);
+            Assert.AreEqual(200.0, X(axis, monday_.AddHours(12)), 1e-3);
+            Assert.AreEqual(200.0, X(axis, tuesday_), 1e-3);
+
+            // a holiday on a weekend changes nothing.
+            axis.Holidays = new DateTime[] {friday_.AddDays(1)};
+            Assert.AreEqual((double) (2*TimeSpan.TicksPerDay), axis.SparseWorldLength, 0.0);
+        }
+
+        [Test]
+        public void TimeOutsideTradingHoursIsCollapsed()
+        {
+            TradingDateTimeAxis axis = Make(friday_, tuesday_);
+            axis.StartTradingTime = new TimeSpan(9, 30, 0);
+            axis.EndTradingTime = new TimeSpan(16, 0, 0);
+            Assert.AreEqual((double) (2*new TimeSpan(6, 30, 0).Ticks), axis.SparseWorldLength, 0.0);
+
+            Assert.AreEqual(0.0, X(axis, friday_.AddHours(8)), 1e-3);
+            Assert.AreEqual(100.0, X(axis, friday_.AddHours(17)), 1e-3);
+            Assert.AreEqual(100.0, X(axis, monday_.AddHours(9.5)), 1e-3);
+            Assert.IsTrue(axis.WithinTradingHours(friday_.AddHours(12).Ticks));
+            Assert.IsFalse(axis.WithinTradingHours(friday_.AddHours(17).Ticks));
+        }
+
+        [Test]
+        public void PhysicalToWorldInvertsWorldToPhysical()
+        {
+            TradingDateTimeAxis axis = Make(friday_, wednesday_);
+            axis.StartTradingTime = new TimeSpan(9, 30, 0);
+            axis.EndTradingTime = new TimeSpan(16, 0, 0);
+            axis.Holidays = new DateTime[] {monday_};
+
+            DateTime[] times =
+                {
+                    friday_.AddHours(10), friday_.AddHours(15.9),
+                    tuesday_.AddHours(9.6), tuesday_.AddHours(12)
+                };
+            foreach (DateTime t in times)
+            {
+                PointF p = axis.WorldToPhysical(t.Ticks, physicalMin_, physicalMax_, false);
+                double world = axis.PhysicalToWorld(p, physicalMin_, physicalMax_, false);
+                Assert.AreEqual((double) t.Ticks, world, (double) TimeSpan.TicksPerSecond, t.ToString("s"));
+            }
+        }
+
+        [Test]
+        public void SparseWorldAddSkipsGaps()
+        {
+            TradingDateTimeAxis axis = Make(friday_, wednesday_);
+            axis.StartTradingTime = new TimeSpan(9, 30, 0);
+            axis.EndTradingTime = new TimeSpan(16, 0, 0);
+            double session = new TimeSpan(6, 30, 0).Ticks;
+
+            Assert.AreEqual((double) monday_.AddHours(12).Ticks, axis.SparseWorldAdd(friday_.AddHours(12).Ticks, session), 0.0);
+
+            axis.Holidays = new DateTime[] {monday_};
+            Assert.AreEqual((double) tuesday_.AddHours(12).Ticks, axis.SparseWorldAdd(friday_.AddHours(12).Ticks, session), 0.0);
+        }
+
+        [Test]
+        public void BulkTransformMatchesSingleValues()
+        {
+            TradingDateTimeAxis axis = Make(friday_, wednesday_);
+            axis.StartTradingTime = new TimeSpan(9, 30, 0);
+            axis.EndTradingTime = new TimeSpan(16, 0, 0);
+            axis.Holidays = new DateTime[] {monday_};
+
+            double[] coords = new double[200];
+            for (int i = 0; i < coords.Length; ++i)
+            {
+                coords[i] = friday_.AddHours(i*0.6).Ticks;
+            }
+            coords[17] = double.NaN;
+
+            float[] x = new float[coords.Length];
+            float[] y = new float[coords.Length];
+            axis.WorldToPhysical(coords, 0, coords.Length, physicalMin_, physicalMax_, x, y);
+
+            for (int i = 0; i < coords.Length; ++i)
+            {
+                if (double.IsNaN(coords[i]))
+                {
+                    Assert.IsNaN(x[i]);
+                    continue;
+                }
+                PointF p = axis.WorldToPhysical(coords[i], physicalMin_, physicalMax_, false);
+                Assert.AreEqual(p.X, x[i], 1e-3, "at " + i);
+                Assert.AreEqual(p.Y, y[i], 1e-3, "at " + i);
+            }
+        }
+    }
+}
\ No newline at end of file